@@ -11,6 +11,7 @@ class ConanConfiguration(ConanFile):
     build_requires = [
         "glm/0.9.9.8",
         "gtest/1.11.0",
+        "benchmark/1.6.1",
         "lodepng/cci.20200615",
         "glfw/3.3.7"
     ]
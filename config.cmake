@@ -63,3 +63,5 @@ option(SKIP_CMAKE_TEST "..." FALSE)
 if(${SKIP_CMAKE_TEST})
     set(TARGET_CMAKE_INSTALL_DEPENDS_ON "${PROJECT_NAME}")
 endif()
+
+option(EXQUDENS_VULKAN_TRACE "..." FALSE)
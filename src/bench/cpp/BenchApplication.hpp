@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include "TestContext.hpp"
+#include "exqudens/vulkan/BuilderBenchmarks.hpp"
+#include "exqudens/vulkan/UploadBenchmarks.hpp"
+#include "exqudens/vulkan/DescriptorBenchmarks.hpp"
+#include "exqudens/vulkan/FrameBenchmarks.hpp"
+
+class BenchApplication {
+
+  public:
+
+    static int run(int argc, char** argv) {
+      std::vector<std::string> arguments(argv, argv + argc);
+      bool outSet = std::ranges::any_of(arguments, [](const std::string& o1) {return o1.starts_with("--benchmark_out=");});
+      if (!outSet) {
+        arguments.emplace_back("--benchmark_out=bench-results.json");
+        arguments.emplace_back("--benchmark_out_format=json");
+      }
+
+      std::vector<char*> tmpArguments = {};
+      for (std::string& argument : arguments) {
+        tmpArguments.emplace_back(argument.data());
+      }
+      int tmpArgc = static_cast<int>(tmpArguments.size());
+
+      TestContext::setValidation(false);
+      benchmark::Initialize(&tmpArgc, tmpArguments.data());
+      if (benchmark::ReportUnrecognizedArguments(tmpArgc, tmpArguments.data())) {
+        return 1;
+      }
+      benchmark::RunSpecifiedBenchmarks();
+      benchmark::Shutdown();
+      TestContext::destroy();
+      return 0;
+    }
+
+};
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include <benchmark/benchmark.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/Vertex.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  static void BM_BufferBuild(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      for (auto _ : state) {
+        Buffer buffer = Buffer::builder()
+            .setPhysicalDevice(context.physicalDevice.value)
+            .setDevice(context.device.value)
+            .setCreateInfo(
+                vk::BufferCreateInfo()
+                    .setSize(static_cast<vk::DeviceSize>(state.range(0)))
+                    .setUsage(vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer)
+                    .setSharingMode(vk::SharingMode::eExclusive)
+            )
+            .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+        .build();
+        benchmark::DoNotOptimize(buffer.value);
+      }
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_BufferBuild)->Arg(64 * 1024)->Arg(4 * 1024 * 1024);
+
+  static void BM_BufferBuildWithAllocator(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      std::shared_ptr<MemoryAllocator> memoryAllocator = std::make_shared<MemoryAllocator>(
+          MemoryAllocator::builder()
+              .setPhysicalDevice(context.physicalDevice.value)
+              .setDevice(context.device.value)
+          .build()
+      );
+      for (auto _ : state) {
+        Buffer buffer = Buffer::builder()
+            .setPhysicalDevice(context.physicalDevice.value)
+            .setDevice(context.device.value)
+            .setMemoryAllocator(memoryAllocator)
+            .setCreateInfo(
+                vk::BufferCreateInfo()
+                    .setSize(static_cast<vk::DeviceSize>(state.range(0)))
+                    .setUsage(vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer)
+                    .setSharingMode(vk::SharingMode::eExclusive)
+            )
+            .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+        .build();
+        benchmark::DoNotOptimize(buffer.value);
+      }
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_BufferBuildWithAllocator)->Arg(64 * 1024)->Arg(4 * 1024 * 1024);
+
+  static void BM_ImageBuild(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t size = static_cast<uint32_t>(state.range(0));
+      for (auto _ : state) {
+        Image image = Image::builder()
+            .setPhysicalDevice(context.physicalDevice.value)
+            .setDevice(context.device.value)
+            .setCreateInfo(
+                vk::ImageCreateInfo()
+                    .setImageType(vk::ImageType::e2D)
+                    .setFormat(vk::Format::eR8G8B8A8Unorm)
+                    .setExtent(vk::Extent3D().setWidth(size).setHeight(size).setDepth(1))
+                    .setMipLevels(1)
+                    .setArrayLayers(1)
+                    .setSamples(vk::SampleCountFlagBits::e1)
+                    .setTiling(vk::ImageTiling::eOptimal)
+                    .setUsage(vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled)
+                    .setSharingMode(vk::SharingMode::eExclusive)
+                    .setInitialLayout(vk::ImageLayout::eUndefined)
+            )
+            .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+        .build();
+        benchmark::DoNotOptimize(image.value);
+      }
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_ImageBuild)->Arg(256)->Arg(1024);
+
+  static void BM_CommandBufferBuild(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); i++) {
+          CommandBuffer commandBuffer = CommandBuffer::builder()
+              .setDevice(context.device.value)
+              .setCreateInfo(
+                  vk::CommandBufferAllocateInfo()
+                      .setCommandPool(*context.graphicsCommandPool.reference())
+                      .setCommandBufferCount(1)
+                      .setLevel(vk::CommandBufferLevel::ePrimary)
+              )
+          .build();
+          benchmark::DoNotOptimize(commandBuffer.value);
+        }
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_CommandBufferBuild)->Arg(3);
+
+  static void BM_CommandBufferBuildAll(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      for (auto _ : state) {
+        std::vector<CommandBuffer> commandBuffers = CommandBuffer::builder()
+            .setDevice(context.device.value)
+            .setCreateInfo(
+                vk::CommandBufferAllocateInfo()
+                    .setCommandPool(*context.graphicsCommandPool.reference())
+                    .setLevel(vk::CommandBufferLevel::ePrimary)
+            )
+        .buildAll(static_cast<uint32_t>(state.range(0)));
+        benchmark::DoNotOptimize(commandBuffers.data());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_CommandBufferBuildAll)->Arg(3);
+
+  static void BM_PipelineBuild(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+
+      DescriptorSetLayout descriptorSetLayout = DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+          )
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(1)
+                  .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eFragment)
+          )
+      .build();
+
+      RenderPass renderPass = RenderPass::builder()
+          .setDevice(context.device.value)
+          .addAttachment(
+              vk::AttachmentDescription()
+                  .setFormat(vk::Format::eR8G8B8A8Unorm)
+                  .setSamples(vk::SampleCountFlagBits::e1)
+                  .setLoadOp(vk::AttachmentLoadOp::eClear)
+                  .setStoreOp(vk::AttachmentStoreOp::eStore)
+                  .setStencilLoadOp(vk::AttachmentLoadOp::eDontCare)
+                  .setStencilStoreOp(vk::AttachmentStoreOp::eDontCare)
+                  .setInitialLayout(vk::ImageLayout::eUndefined)
+                  .setFinalLayout(vk::ImageLayout::eTransferSrcOptimal)
+          )
+          .addSubpass(
+              SubpassDescription()
+                  .setPipelineBindPoint(vk::PipelineBindPoint::eGraphics)
+                  .addColorAttachment(
+                      vk::AttachmentReference()
+                          .setAttachment(0)
+                          .setLayout(vk::ImageLayout::eColorAttachmentOptimal)
+                  )
+          )
+      .build();
+
+      std::vector<vk::DynamicState> dynamicStates = {vk::DynamicState::eViewport, vk::DynamicState::eScissor};
+
+      std::shared_ptr<ShaderModuleCache> shaderModuleCache;
+      if (state.range(0) != 0) {
+        shaderModuleCache = std::make_shared<ShaderModuleCache>(
+            ShaderModuleCache::builder()
+                .setDevice(context.device.value)
+            .build()
+        );
+      }
+
+      for (auto _ : state) {
+        Pipeline pipeline = Pipeline::builder()
+            .setDevice(context.device.value)
+            .setShaderModuleCache(shaderModuleCache)
+            .addPath("resources/shader/shader-4.vert.spv")
+            .addPath("resources/shader/shader-4.frag.spv")
+            .addSetLayout(*descriptorSetLayout.reference())
+            .setGraphicsCreateInfo(
+                GraphicsPipelineCreateInfo()
+                    .setRenderPass(*renderPass.reference())
+                    .setSubpass(0)
+                    .setVertexInputState(
+                        PipelineVertexInputStateCreateInfo()
+                            .setVertexBindingDescriptions({Vertex::getBindingDescription()})
+                            .setVertexAttributeDescriptions(Vertex::getAttributeDescriptions())
+                    )
+                    .setInputAssemblyState(
+                        vk::PipelineInputAssemblyStateCreateInfo()
+                            .setTopology(vk::PrimitiveTopology::eTriangleList)
+                    )
+                    .setViewportState(
+                        PipelineViewportStateCreateInfo()
+                            .setViewportCount(1)
+                            .setScissorCount(1)
+                    )
+                    .setRasterizationState(
+                        vk::PipelineRasterizationStateCreateInfo()
+                            .setPolygonMode(vk::PolygonMode::eFill)
+                            .setCullMode(vk::CullModeFlagBits::eBack)
+                            .setFrontFace(vk::FrontFace::eCounterClockwise)
+                            .setLineWidth(1.0)
+                    )
+                    .setMultisampleState(
+                        vk::PipelineMultisampleStateCreateInfo()
+                            .setRasterizationSamples(vk::SampleCountFlagBits::e1)
+                    )
+                    .setColorBlendState(
+                        PipelineColorBlendStateCreateInfo()
+                            .setAttachments({
+                                vk::PipelineColorBlendAttachmentState()
+                                    .setColorWriteMask(vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA)
+                            })
+                    )
+                    .setDynamicState(
+                        vk::PipelineDynamicStateCreateInfo()
+                            .setDynamicStates(dynamicStates)
+                    )
+            )
+        .build();
+        benchmark::DoNotOptimize(pipeline.value);
+      }
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_PipelineBuild)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include <benchmark/benchmark.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  static DescriptorSetLayout createUniformBufferLayout(TestContext& context) {
+    try {
+      return DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+          )
+      .build();
+    } catch (...) {
+      std::throw_with_nested(std::runtime_error(CALL_INFO()));
+    }
+  }
+
+  static DescriptorPool createUniformBufferPool(TestContext& context, const uint32_t& count) {
+    try {
+      return DescriptorPool::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(
+              vk::DescriptorPoolSize()
+                  .setType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(count)
+          )
+          .setCreateInfo(
+              vk::DescriptorPoolCreateInfo()
+                  .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+                  .setMaxSets(count)
+          )
+      .build();
+    } catch (...) {
+      std::throw_with_nested(std::runtime_error(CALL_INFO()));
+    }
+  }
+
+  static Buffer createUniformBuffer(TestContext& context, const vk::DeviceSize& size) {
+    try {
+      return Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(size)
+                  .setUsage(vk::BufferUsageFlagBits::eUniformBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+      .build();
+    } catch (...) {
+      std::throw_with_nested(std::runtime_error(CALL_INFO()));
+    }
+  }
+
+  static void BM_DescriptorSetUpdate(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t count = static_cast<uint32_t>(state.range(0));
+
+      DescriptorSetLayout descriptorSetLayout = createUniformBufferLayout(context);
+
+      DescriptorPool descriptorPool = createUniformBufferPool(context, count);
+
+      Buffer buffer = createUniformBuffer(context, 256);
+
+      std::vector<DescriptorSet> descriptorSets = DescriptorSet::builder()
+          .setDevice(context.device.value)
+          .addSetLayout(*descriptorSetLayout.reference())
+          .setCreateInfo(
+              vk::DescriptorSetAllocateInfo()
+                  .setDescriptorPool(*descriptorPool.reference())
+          )
+      .buildAll(count);
+
+      std::vector<vk::DescriptorBufferInfo> bufferInfos = {
+          vk::DescriptorBufferInfo()
+              .setBuffer(*buffer.reference())
+              .setOffset(0)
+              .setRange(256)
+      };
+      std::vector<vk::WriteDescriptorSet> writes;
+      writes.reserve(count);
+      for (DescriptorSet& descriptorSet : descriptorSets) {
+        writes.emplace_back(
+            vk::WriteDescriptorSet()
+                .setDstSet(*descriptorSet.reference())
+                .setDstBinding(0)
+                .setDstArrayElement(0)
+                .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                .setBufferInfo(bufferInfos)
+        );
+      }
+
+      for (auto _ : state) {
+        context.device.reference().updateDescriptorSets(writes, {});
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_DescriptorSetUpdate)->Arg(1)->Arg(64)->Arg(1024);
+
+  static void BM_DescriptorSetUpdateTemplate(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t count = static_cast<uint32_t>(state.range(0));
+
+      DescriptorSetLayout descriptorSetLayout = createUniformBufferLayout(context);
+
+      DescriptorAllocator descriptorAllocator = DescriptorAllocator::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(
+              vk::DescriptorPoolSize()
+                  .setType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(count)
+          )
+          .setCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(count))
+      .build();
+
+      DescriptorUpdateTemplate descriptorUpdateTemplate = DescriptorUpdateTemplate::builder()
+          .setDevice(context.device.value)
+          .setDescriptorSetLayout(descriptorSetLayout)
+      .build();
+
+      Buffer buffer = createUniformBuffer(context, 256);
+
+      std::vector<vk::DescriptorSet> descriptorSets = descriptorAllocator.allocate(
+          std::vector<vk::DescriptorSetLayout>(count, *descriptorSetLayout.reference())
+      );
+      vk::DescriptorBufferInfo bufferInfo = vk::DescriptorBufferInfo()
+          .setBuffer(*buffer.reference())
+          .setOffset(0)
+          .setRange(256);
+
+      for (auto _ : state) {
+        for (const vk::DescriptorSet& descriptorSet : descriptorSets) {
+          descriptorUpdateTemplate.update(descriptorSet, bufferInfo);
+        }
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_DescriptorSetUpdateTemplate)->Arg(1)->Arg(64)->Arg(1024);
+
+  static void BM_DescriptorSetAllocate(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t count = static_cast<uint32_t>(state.range(0));
+
+      DescriptorSetLayout descriptorSetLayout = createUniformBufferLayout(context);
+
+      DescriptorPool descriptorPool = createUniformBufferPool(context, count);
+
+      for (auto _ : state) {
+        std::vector<DescriptorSet> descriptorSets = DescriptorSet::builder()
+            .setDevice(context.device.value)
+            .addSetLayout(*descriptorSetLayout.reference())
+            .setCreateInfo(
+                vk::DescriptorSetAllocateInfo()
+                    .setDescriptorPool(*descriptorPool.reference())
+            )
+        .buildAll(count);
+        benchmark::DoNotOptimize(descriptorSets.data());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_DescriptorSetAllocate)->Arg(64)->Arg(1024);
+
+  static void BM_DescriptorAllocatorAllocate(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t count = static_cast<uint32_t>(state.range(0));
+
+      DescriptorSetLayout descriptorSetLayout = createUniformBufferLayout(context);
+
+      DescriptorAllocator descriptorAllocator = DescriptorAllocator::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(
+              vk::DescriptorPoolSize()
+                  .setType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(64)
+          )
+          .setCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(64))
+      .build();
+
+      std::vector<vk::DescriptorSetLayout> setLayouts(count, *descriptorSetLayout.reference());
+      for (auto _ : state) {
+        descriptorAllocator.beginFrame(0);
+        std::vector<vk::DescriptorSet> descriptorSets = descriptorAllocator.allocate(setLayouts);
+        benchmark::DoNotOptimize(descriptorSets.data());
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+      state.counters["pools"] = static_cast<double>(descriptorAllocator.poolCount());
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_DescriptorAllocatorAllocate)->Arg(64)->Arg(1024);
+
+  static void BM_DescriptorSetCacheGet(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t count = static_cast<uint32_t>(state.range(0));
+
+      DescriptorSetLayout descriptorSetLayout = createUniformBufferLayout(context);
+
+      DescriptorSetCache descriptorSetCache = DescriptorSetCache::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(
+              vk::DescriptorPoolSize()
+                  .setType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(count)
+          )
+          .setPoolCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(count))
+      .build();
+
+      Buffer buffer = createUniformBuffer(context, 256 * count);
+
+      std::vector<std::vector<WriteDescriptorSet>> writes;
+      writes.reserve(count);
+      for (uint32_t i = 0; i < count; i++) {
+        writes.emplace_back(std::vector<WriteDescriptorSet> {
+            WriteDescriptorSet()
+                .setDstBinding(0)
+                .setDstArrayElement(0)
+                .setDescriptorCount(1)
+                .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                .setBufferInfo({vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(256 * i).setRange(256)})
+        });
+      }
+
+      for (auto _ : state) {
+        descriptorSetCache.beginFrame();
+        for (const std::vector<WriteDescriptorSet>& write : writes) {
+          benchmark::DoNotOptimize(descriptorSetCache.get(*descriptorSetLayout.reference(), write));
+        }
+      }
+      state.SetItemsProcessed(state.iterations() * state.range(0));
+      state.counters["hitRate"] = descriptorSetCache.hitRate();
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_DescriptorSetCacheGet)->Arg(64)->Arg(1024);
+
+}
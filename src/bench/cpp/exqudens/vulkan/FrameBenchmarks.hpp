@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+
+#include <benchmark/benchmark.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  static void BM_FrameTime(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      uint32_t size = static_cast<uint32_t>(state.range(0));
+      vk::Extent2D extent = vk::Extent2D().setWidth(size).setHeight(size);
+
+      OffscreenTarget offscreenTarget = OffscreenTarget::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setQueue(context.graphicsQueue.value)
+          .setCommandPool(*context.graphicsCommandPool.reference())
+          .setFormat(vk::Format::eR8G8B8A8Unorm)
+          .setExtent(extent)
+          .setImageCount(2)
+      .build();
+
+      RenderPass renderPass = RenderPass::builder()
+          .setDevice(context.device.value)
+          .addAttachment(
+              vk::AttachmentDescription()
+                  .setFormat(offscreenTarget.createInfo.format)
+                  .setSamples(vk::SampleCountFlagBits::e1)
+                  .setLoadOp(vk::AttachmentLoadOp::eClear)
+                  .setStoreOp(vk::AttachmentStoreOp::eStore)
+                  .setStencilLoadOp(vk::AttachmentLoadOp::eDontCare)
+                  .setStencilStoreOp(vk::AttachmentStoreOp::eDontCare)
+                  .setInitialLayout(vk::ImageLayout::eUndefined)
+                  .setFinalLayout(vk::ImageLayout::eTransferSrcOptimal)
+          )
+          .addSubpass(
+              SubpassDescription()
+                  .setPipelineBindPoint(vk::PipelineBindPoint::eGraphics)
+                  .addColorAttachment(
+                      vk::AttachmentReference()
+                          .setAttachment(0)
+                          .setLayout(vk::ImageLayout::eColorAttachmentOptimal)
+                  )
+          )
+      .build();
+
+      std::vector<Framebuffer> framebuffers;
+      for (ImageView& imageView : offscreenTarget.imageViews) {
+        framebuffers.emplace_back(
+            Framebuffer::builder()
+                .setDevice(context.device.value)
+                .addAttachment(*imageView.reference())
+                .setCreateInfo(
+                    vk::FramebufferCreateInfo()
+                        .setRenderPass(*renderPass.reference())
+                        .setWidth(extent.width)
+                        .setHeight(extent.height)
+                        .setLayers(1)
+                )
+            .build()
+        );
+      }
+
+      FrameRing<2> frameRing = FrameRing<2>::builder()
+          .setDevice(context.device.value)
+          .setCommandPool(*context.graphicsCommandPool.reference())
+      .build();
+
+      std::vector<vk::ClearValue> clearValues = {
+          vk::ClearValue().setColor(vk::ClearColorValue().setFloat32({0.0f, 0.0f, 0.0f, 1.0f}))
+      };
+
+      for (auto _ : state) {
+        frameRing.begin(offscreenTarget);
+        vk::raii::CommandBuffer& commandBuffer = frameRing.commandBufferReference();
+        commandBuffer.beginRenderPass(
+            vk::RenderPassBeginInfo()
+                .setRenderPass(*renderPass.reference())
+                .setFramebuffer(*framebuffers[frameRing.imageIndex].reference())
+                .setRenderArea(vk::Rect2D().setOffset(vk::Offset2D().setX(0).setY(0)).setExtent(extent))
+                .setClearValues(clearValues),
+            vk::SubpassContents::eInline
+        );
+        commandBuffer.endRenderPass();
+        frameRing.submit(context.graphicsQueue.reference());
+        frameRing.present(offscreenTarget);
+      }
+
+      context.device.reference().waitIdle();
+      state.counters["cpu_wait_us"] = std::chrono::duration<double, std::micro>(frameRing.averageWaitTime()).count();
+      state.SetItemsProcessed(state.iterations());
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_FrameTime)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+}
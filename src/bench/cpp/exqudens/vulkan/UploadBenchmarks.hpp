@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include <benchmark/benchmark.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  static void BM_UploadBuffer(benchmark::State& state) {
+    try {
+      TestContext& context = TestContext::get();
+      vk::DeviceSize size = static_cast<vk::DeviceSize>(state.range(0));
+      std::vector<uint8_t> data(static_cast<size_t>(size), 0xAB);
+
+      UploadQueue uploadQueue = UploadQueue::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setQueue(context.transferQueue.value)
+          .setSrcQueueFamilyIndex(context.transferQueue.familyIndex)
+          .setDstQueueFamilyIndex(context.graphicsQueue.familyIndex)
+          .setStagingSize(size * 2)
+      .build();
+
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(size)
+                  .setUsage(vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+      .build();
+
+      for (auto _ : state) {
+        uploadQueue.uploadBuffer(
+            data.data(),
+            size,
+            *buffer.reference(),
+            0,
+            vk::AccessFlagBits::eVertexAttributeRead,
+            vk::PipelineStageFlagBits::eVertexInput
+        );
+        uint64_t id = uploadQueue.flush();
+        uploadQueue.waitIdle();
+        context.submit([&uploadQueue, &id](vk::raii::CommandBuffer& commandBuffer) {
+          uploadQueue.recordAcquire(commandBuffer, id);
+        });
+      }
+      state.SetBytesProcessed(state.iterations() * state.range(0));
+    } catch (const std::exception& e) {
+      state.SkipWithError(TestUtils::toString(e).c_str());
+    }
+  }
+  BENCHMARK(BM_UploadBuffer)->Arg(1024 * 1024)->Arg(16 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+
+}
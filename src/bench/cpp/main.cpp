@@ -0,0 +1,5 @@
+#include "BenchApplication.hpp"
+
+int main(int argc, char** argv) {
+  return BenchApplication::run(argc, argv);
+}
@@ -0,0 +1,353 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/DescriptorSetLayout.hpp"
+
+namespace exqudens::vulkan {
+
+  struct BindlessTable {
+
+    class Builder;
+
+    static Builder builder();
+
+    inline static const uint32_t IMAGE_BINDING = 0;
+    inline static const uint32_t SAMPLER_BINDING = 1;
+    inline static const uint32_t BUFFER_BINDING = 2;
+
+    struct Slots {
+
+      uint32_t capacity = 0;
+      uint32_t next = 0;
+      std::vector<uint32_t> free;
+      std::vector<std::pair<uint64_t, uint32_t>> retired;
+      std::vector<bool> live;
+
+      uint32_t acquire() {
+        try {
+          if (!free.empty()) {
+            uint32_t result = free.back();
+            free.pop_back();
+            live[result] = true;
+            return result;
+          }
+          if (next >= capacity) {
+            throw std::runtime_error(CALL_INFO() + ": capacity: " + std::to_string(capacity) + " is exhausted!");
+          }
+          live.resize(next + 1, false);
+          live[next] = true;
+          return next++;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void release(const uint32_t& index, const uint64_t& frame) {
+        try {
+          if (index >= next || !live[index]) {
+            throw std::invalid_argument(CALL_INFO() + ": index: " + std::to_string(index) + " is not acquired!");
+          }
+          live[index] = false;
+          retired.emplace_back(frame, index);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void recycle(const uint64_t& frame, const uint64_t& frameCount) {
+        try {
+          std::erase_if(retired, [this, &frame, &frameCount](const std::pair<uint64_t, uint32_t>& entry) {
+            if (entry.first + frameCount > frame) {
+              return false;
+            }
+            free.emplace_back(entry.second);
+            return true;
+          });
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      size_t size() const {
+        return next - free.size() - retired.size();
+      }
+
+    };
+
+    std::weak_ptr<vk::raii::Device> device;
+    Slots images;
+    Slots samplers;
+    Slots buffers;
+    DescriptorSetLayout layout;
+    vk::DescriptorPoolCreateInfo poolCreateInfo;
+    std::shared_ptr<vk::raii::DescriptorPool> pool;
+    std::shared_ptr<vk::raii::DescriptorSet> value;
+    uint64_t frameCount = 0;
+    uint64_t frame = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    vk::raii::DescriptorSet& reference() {
+      try {
+        if (!value) {
+          throw std::runtime_error(CALL_INFO() + ": value is not initialized!");
+        }
+        return *value;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t addImageView(const vk::ImageView& imageView, const vk::ImageLayout& imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        uint32_t index = images.acquire();
+        std::vector<vk::DescriptorImageInfo> imageInfos = {vk::DescriptorImageInfo().setImageView(imageView).setImageLayout(imageLayout)};
+        write(IMAGE_BINDING, index, vk::DescriptorType::eSampledImage, imageInfos, {});
+        return index;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t addSampler(const vk::Sampler& sampler) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        uint32_t index = samplers.acquire();
+        std::vector<vk::DescriptorImageInfo> imageInfos = {vk::DescriptorImageInfo().setSampler(sampler)};
+        write(SAMPLER_BINDING, index, vk::DescriptorType::eSampler, imageInfos, {});
+        return index;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t addBuffer(const vk::Buffer& buffer, const vk::DeviceSize& offset = 0, const vk::DeviceSize& range = VK_WHOLE_SIZE) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        uint32_t index = buffers.acquire();
+        std::vector<vk::DescriptorBufferInfo> bufferInfos = {vk::DescriptorBufferInfo().setBuffer(buffer).setOffset(offset).setRange(range)};
+        write(BUFFER_BINDING, index, vk::DescriptorType::eStorageBuffer, {}, bufferInfos);
+        return index;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    // removed indices are reused only after frameCount further beginFrame() calls, frames in flight may still read them
+    void removeImageView(const uint32_t& index) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        images.release(index, frame);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void removeSampler(const uint32_t& index) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        samplers.release(index, frame);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void removeBuffer(const uint32_t& index) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        buffers.release(index, frame);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    // call once per frame after waiting for the oldest frame in flight
+    void beginFrame() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        frame++;
+        images.recycle(frame, frameCount);
+        samplers.recycle(frame, frameCount);
+        buffers.recycle(frame, frameCount);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void bind(
+        vk::raii::CommandBuffer& commandBuffer,
+        const vk::PipelineBindPoint& pipelineBindPoint,
+        const vk::PipelineLayout& pipelineLayout,
+        const uint32_t& firstSet = 0
+    ) {
+      try {
+        commandBuffer.bindDescriptorSets(pipelineBindPoint, pipelineLayout, firstSet, {*reference()}, {});
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      void write(
+          const uint32_t& binding,
+          const uint32_t& index,
+          const vk::DescriptorType& type,
+          const std::vector<vk::DescriptorImageInfo>& imageInfos,
+          const std::vector<vk::DescriptorBufferInfo>& bufferInfos
+      ) {
+        vk::WriteDescriptorSet write = vk::WriteDescriptorSet()
+            .setDstSet(*reference())
+            .setDstBinding(binding)
+            .setDstArrayElement(index)
+            .setDescriptorType(type);
+        if (!imageInfos.empty()) {
+          write.setImageInfo(imageInfos);
+        } else {
+          write.setBufferInfo(bufferInfos);
+        }
+        device.lock()->updateDescriptorSets({write}, {});
+      }
+
+  };
+
+  class BindlessTable::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::optional<uint32_t> imageCapacity;
+      std::optional<uint32_t> samplerCapacity;
+      std::optional<uint32_t> bufferCapacity;
+      std::optional<vk::ShaderStageFlags> stageFlags;
+      std::optional<uint32_t> frameCount;
+
+    public:
+
+      BindlessTable::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      BindlessTable::Builder& setImageCapacity(const uint32_t& val) {
+        imageCapacity = val;
+        return *this;
+      }
+
+      BindlessTable::Builder& setSamplerCapacity(const uint32_t& val) {
+        samplerCapacity = val;
+        return *this;
+      }
+
+      BindlessTable::Builder& setBufferCapacity(const uint32_t& val) {
+        bufferCapacity = val;
+        return *this;
+      }
+
+      BindlessTable::Builder& setStageFlags(const vk::ShaderStageFlags& val) {
+        stageFlags = val;
+        return *this;
+      }
+
+      BindlessTable::Builder& setFrameCount(const uint32_t& val) {
+        frameCount = val;
+        return *this;
+      }
+
+      BindlessTable build() {
+        try {
+          BindlessTable target = {};
+          target.device = device;
+          target.images.capacity = std::max<uint32_t>(imageCapacity.value_or(1024), 1);
+          target.samplers.capacity = std::max<uint32_t>(samplerCapacity.value_or(32), 1);
+          target.buffers.capacity = std::max<uint32_t>(bufferCapacity.value_or(1024), 1);
+          target.frameCount = std::max<uint32_t>(frameCount.value_or(2), 1);
+
+          vk::ShaderStageFlags tmpStageFlags = stageFlags.value_or(vk::ShaderStageFlagBits::eAll);
+          vk::DescriptorBindingFlags bindingFlags = vk::DescriptorBindingFlagBits::ePartiallyBound
+              | vk::DescriptorBindingFlagBits::eUpdateAfterBind
+              | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+          std::vector<vk::DescriptorBindingFlags> tmpBindingFlags(3, bindingFlags);
+          vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo()
+              .setBindingFlags(tmpBindingFlags);
+          target.layout = DescriptorSetLayout::builder()
+              .setDevice(device)
+              .addBinding(
+                  vk::DescriptorSetLayoutBinding()
+                      .setBinding(IMAGE_BINDING)
+                      .setDescriptorType(vk::DescriptorType::eSampledImage)
+                      .setDescriptorCount(target.images.capacity)
+                      .setStageFlags(tmpStageFlags)
+              )
+              .addBinding(
+                  vk::DescriptorSetLayoutBinding()
+                      .setBinding(SAMPLER_BINDING)
+                      .setDescriptorType(vk::DescriptorType::eSampler)
+                      .setDescriptorCount(target.samplers.capacity)
+                      .setStageFlags(tmpStageFlags)
+              )
+              .addBinding(
+                  vk::DescriptorSetLayoutBinding()
+                      .setBinding(BUFFER_BINDING)
+                      .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                      .setDescriptorCount(target.buffers.capacity)
+                      .setStageFlags(tmpStageFlags)
+              )
+              .setCreateInfo(
+                  vk::DescriptorSetLayoutCreateInfo()
+                      .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
+                      .setPNext(&bindingFlagsCreateInfo)
+              )
+          .build();
+          target.layout.createInfo.setPNext(nullptr);
+
+          std::vector<vk::DescriptorPoolSize> poolSizes = {
+              vk::DescriptorPoolSize().setType(vk::DescriptorType::eSampledImage).setDescriptorCount(target.images.capacity),
+              vk::DescriptorPoolSize().setType(vk::DescriptorType::eSampler).setDescriptorCount(target.samplers.capacity),
+              vk::DescriptorPoolSize().setType(vk::DescriptorType::eStorageBuffer).setDescriptorCount(target.buffers.capacity)
+          };
+          target.poolCreateInfo = vk::DescriptorPoolCreateInfo()
+              .setFlags(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind | vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+              .setMaxSets(1)
+              .setPoolSizes(poolSizes);
+          target.pool = std::make_shared<vk::raii::DescriptorPool>(
+              *device.lock(),
+              target.poolCreateInfo
+          );
+          target.poolCreateInfo.setPoolSizes({});
+
+          std::vector<vk::DescriptorSetLayout> setLayouts = {*target.layout.reference()};
+          vk::raii::DescriptorSets values = vk::raii::DescriptorSets(
+              *device.lock(),
+              vk::DescriptorSetAllocateInfo()
+                  .setDescriptorPool(*(*target.pool))
+                  .setSetLayouts(setLayouts)
+          );
+          target.value = std::make_shared<vk::raii::DescriptorSet>(std::move(values.front()));
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  BindlessTable::Builder BindlessTable::builder() {
+    return {};
+  }
+
+}
@@ -7,6 +7,9 @@
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+#include "exqudens/vulkan/MemoryAllocator.hpp"
 
 namespace exqudens::vulkan {
 
@@ -17,9 +20,11 @@ namespace exqudens::vulkan {
     static Builder builder();
 
     vk::BufferCreateInfo createInfo;
+    std::shared_ptr<MemoryAllocation> allocation;
     std::shared_ptr<vk::raii::Buffer> value;
     vk::MemoryPropertyFlags memoryCreateInfo;
     std::shared_ptr<vk::raii::DeviceMemory> memory;
+    vk::DeviceSize memoryOffset;
 
     vk::raii::Buffer& reference() {
       try {
@@ -43,6 +48,43 @@ namespace exqudens::vulkan {
       }
     }
 
+    void* data() {
+      try {
+        if (!allocation) {
+          throw std::runtime_error(CALL_INFO() + ": buffer is not suballocated, use mapMemory()!");
+        }
+        void* result = allocation->data();
+        if (result == nullptr) {
+          throw std::runtime_error(CALL_INFO() + ": buffer memory is not host visible!");
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void* mapMemory(const vk::DeviceSize& offset = 0, const vk::DeviceSize& size = VK_WHOLE_SIZE) {
+      try {
+        if (allocation) {
+          throw std::runtime_error(CALL_INFO() + ": suballocated buffer memory is persistently mapped, use data()!");
+        }
+        return memoryReference().mapMemory(memoryOffset + offset, size);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void unmapMemory() {
+      try {
+        if (allocation) {
+          throw std::runtime_error(CALL_INFO() + ": suballocated buffer memory is persistently mapped!");
+        }
+        memoryReference().unmapMemory();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Buffer::Builder {
@@ -56,6 +98,8 @@ namespace exqudens::vulkan {
           const uint32_t&,
           const vk::MemoryPropertyFlags&
       )> memoryTypeIndexFunction;
+      std::weak_ptr<MemoryTypeSelector> memoryTypeSelector;
+      std::weak_ptr<MemoryAllocator> memoryAllocator;
       std::optional<vk::BufferCreateInfo> createInfo;
       std::optional<vk::MemoryPropertyFlags> memoryCreateInfo;
 
@@ -82,6 +126,16 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Buffer::Builder& setMemoryTypeSelector(const std::weak_ptr<MemoryTypeSelector>& val) {
+        memoryTypeSelector = val;
+        return *this;
+      }
+
+      Buffer::Builder& setMemoryAllocator(const std::weak_ptr<MemoryAllocator>& val) {
+        memoryAllocator = val;
+        return *this;
+      }
+
       Buffer::Builder& setCreateInfo(const vk::BufferCreateInfo& val) {
         createInfo = val;
         return *this;
@@ -94,30 +148,52 @@ namespace exqudens::vulkan {
 
       Buffer build() {
         try {
-          if (!memoryTypeIndexFunction) {
-            memoryTypeIndexFunction = &Utility::memoryTypeIndex;
-          }
-
           Buffer target = {};
           target.createInfo = createInfo.value();
           target.value = std::make_shared<vk::raii::Buffer>(
               *device.lock(),
               target.createInfo
           );
-          vk::MemoryRequirements memoryRequirements = target.reference().getMemoryRequirements();
-          uint32_t memoryType = memoryTypeIndexFunction(
-              *physicalDevice.lock(),
-              memoryRequirements.memoryTypeBits,
-              target.memoryCreateInfo
-          );
           target.memoryCreateInfo = memoryCreateInfo.value();
-          target.memory = std::make_shared<vk::raii::DeviceMemory>(
-              *device.lock(),
-              vk::MemoryAllocateInfo()
-                  .setAllocationSize(memoryRequirements.size)
-                  .setMemoryTypeIndex(memoryType)
-          );
-          target.reference().bindMemory(*target.memoryReference(), 0);
+          vk::MemoryRequirements memoryRequirements = target.reference().getMemoryRequirements();
+          if (!memoryAllocator.expired()) {
+            target.allocation = memoryAllocator.lock()->allocate(
+                memoryRequirements,
+                target.memoryCreateInfo,
+                true
+            );
+            target.memory = target.allocation->block->memory;
+            target.memoryOffset = target.allocation->offset;
+          } else {
+            uint32_t memoryType = 0;
+            if (memoryTypeIndexFunction) {
+              memoryType = memoryTypeIndexFunction(
+                  *physicalDevice.lock(),
+                  memoryRequirements.memoryTypeBits,
+                  target.memoryCreateInfo
+              );
+            } else {
+              std::shared_ptr<MemoryTypeSelector> selector = memoryTypeSelector.lock();
+              if (!selector) {
+                selector = MemoryTypeSelector::shared(physicalDevice);
+              }
+              memoryType = selector->memoryTypeIndex(
+                  memoryRequirements.memoryTypeBits,
+                  target.memoryCreateInfo,
+                  {},
+                  {},
+                  memoryRequirements.size
+              );
+            }
+            target.memory = std::make_shared<vk::raii::DeviceMemory>(
+                *device.lock(),
+                vk::MemoryAllocateInfo()
+                    .setAllocationSize(memoryRequirements.size)
+                    .setMemoryTypeIndex(memoryType)
+            );
+            target.memoryOffset = 0;
+          }
+          target.reference().bindMemory(*target.memoryReference(), target.memoryOffset);
           return target;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <vector>
 #include <memory>
 #include <stdexcept>
 
@@ -66,6 +68,29 @@ namespace exqudens::vulkan {
         }
       }
 
+      std::vector<CommandBuffer> buildAll(const uint32_t& count) {
+        try {
+          vk::CommandBufferAllocateInfo tmpCreateInfo = createInfo.value();
+          tmpCreateInfo.setCommandBufferCount(count);
+          vk::raii::CommandBuffers values = vk::raii::CommandBuffers(
+              *device.lock(),
+              tmpCreateInfo
+          );
+          std::vector<CommandBuffer> targets = {};
+          targets.reserve(values.size());
+          for (vk::raii::CommandBuffer& value : values) {
+            CommandBuffer target = {};
+            target.createInfo = tmpCreateInfo;
+            target.createInfo.setCommandBufferCount(1);
+            target.value = std::make_shared<vk::raii::CommandBuffer>(std::move(value));
+            targets.emplace_back(target);
+          }
+          return targets;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
   CommandBuffer::Builder CommandBuffer::builder() {
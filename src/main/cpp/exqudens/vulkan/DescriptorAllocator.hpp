@@ -0,0 +1,283 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/DescriptorSetLayout.hpp"
+#include "exqudens/vulkan/WriteDescriptorSet.hpp"
+
+namespace exqudens::vulkan {
+
+  struct DescriptorAllocator {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Frame {
+
+      std::vector<std::shared_ptr<vk::raii::DescriptorPool>> pools;
+      uint64_t setCount = 0;
+      uint64_t resetCount = 0;
+
+    };
+
+    static std::vector<vk::DescriptorPoolSize> scale(const std::vector<vk::DescriptorPoolSize>& poolSizes, const double& factor) {
+      try {
+        std::vector<vk::DescriptorPoolSize> result = poolSizes;
+        for (vk::DescriptorPoolSize& poolSize : result) {
+          poolSize.setDescriptorCount(std::max<uint32_t>(static_cast<uint32_t>(std::ceil(poolSize.descriptorCount * factor)), 1));
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::vector<vk::DescriptorPoolSize> poolSizes;
+    vk::DescriptorPoolCreateInfo createInfo;
+    double growthFactor = 1.0;
+    uint32_t maxSetsLimit = 0;
+    uint32_t nextMaxSets = 0;
+    std::vector<Frame> frames;
+    size_t currentFrame = 0;
+    std::vector<std::shared_ptr<vk::raii::DescriptorPool>> freePools;
+    uint64_t poolCreateCount = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    void beginFrame(const size_t& frame) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        currentFrame = frame % frames.size();
+        Frame& target = frames[currentFrame];
+        for (std::shared_ptr<vk::raii::DescriptorPool>& pool : target.pools) {
+          pool->reset();
+          freePools.emplace_back(pool);
+        }
+        target.pools.clear();
+        target.setCount = 0;
+        target.resetCount++;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::DescriptorSet allocate(const vk::DescriptorSetLayout& setLayout) {
+      try {
+        return allocate(std::vector<vk::DescriptorSetLayout> {setLayout}).front();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::DescriptorSet allocate(const vk::DescriptorSetLayout& setLayout, std::vector<WriteDescriptorSet> writes) {
+      try {
+        vk::DescriptorSet result = allocate(setLayout);
+        std::vector<vk::WriteDescriptorSet> tmpWrites;
+        for (WriteDescriptorSet& write : writes) {
+          write.setDstSet(result);
+          tmpWrites.emplace_back(write);
+        }
+        if (!tmpWrites.empty()) {
+          device.lock()->updateDescriptorSets(tmpWrites, {});
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::vector<vk::DescriptorSet> allocate(const std::vector<vk::DescriptorSetLayout>& setLayouts) {
+      try {
+        if (setLayouts.empty()) {
+          return {};
+        }
+        std::shared_ptr<vk::raii::Device> sharedDevice = device.lock();
+        std::lock_guard<std::mutex> lock(*mutex);
+        Frame& frame = frames[currentFrame];
+        std::vector<VkDescriptorSet> handles(setLayouts.size());
+        for (size_t attempt = 0; attempt < 2; attempt++) {
+          if (frame.pools.empty() || attempt > 0) {
+            frame.pools.emplace_back(acquirePool(*sharedDevice, attempt == 0));
+          }
+          vk::DescriptorSetAllocateInfo allocateInfo = vk::DescriptorSetAllocateInfo()
+              .setDescriptorPool(**frame.pools.back())
+              .setSetLayouts(setLayouts);
+          vk::Result result = static_cast<vk::Result>(sharedDevice->getDispatcher()->vkAllocateDescriptorSets(
+              static_cast<VkDevice>(**sharedDevice),
+              reinterpret_cast<const VkDescriptorSetAllocateInfo*>(&allocateInfo),
+              handles.data()
+          ));
+          if (vk::Result::eSuccess == result) {
+            frame.setCount += handles.size();
+            return std::vector<vk::DescriptorSet>(handles.begin(), handles.end());
+          } else if (vk::Result::eErrorOutOfPoolMemory != result && vk::Result::eErrorFragmentedPool != result) {
+            throw std::runtime_error(CALL_INFO() + ": failed to allocate descriptor sets: " + vk::to_string(result) + "!");
+          }
+        }
+        throw std::runtime_error(CALL_INFO() + ": failed to allocate " + std::to_string(setLayouts.size()) + " descriptor sets from a new pool!");
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::DescriptorSet pushDescriptorSet(
+        vk::raii::CommandBuffer& commandBuffer,
+        const vk::PipelineBindPoint& pipelineBindPoint,
+        const vk::PipelineLayout& pipelineLayout,
+        const uint32_t& set,
+        DescriptorSetLayout& setLayout,
+        const std::vector<WriteDescriptorSet>& writes
+    ) {
+      try {
+        if (setLayout.pushDescriptor) {
+          std::vector<vk::WriteDescriptorSet> tmpWrites(writes.begin(), writes.end());
+          commandBuffer.pushDescriptorSetKHR(pipelineBindPoint, pipelineLayout, set, tmpWrites);
+          return {};
+        }
+        vk::DescriptorSet result = allocate(*setLayout.reference(), writes);
+        commandBuffer.bindDescriptorSets(pipelineBindPoint, pipelineLayout, set, result, {});
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    size_t poolCount() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        size_t result = freePools.size();
+        for (const Frame& frame : frames) {
+          result += frame.pools.size();
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void clear() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        for (Frame& frame : frames) {
+          frame.pools.clear();
+          frame.setCount = 0;
+        }
+        freePools.clear();
+        nextMaxSets = createInfo.maxSets;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      std::shared_ptr<vk::raii::DescriptorPool> acquirePool(vk::raii::Device& target, const bool& reuse) {
+        if (reuse && !freePools.empty()) {
+          std::shared_ptr<vk::raii::DescriptorPool> result = freePools.back();
+          freePools.pop_back();
+          return result;
+        }
+        double factor = static_cast<double>(nextMaxSets) / static_cast<double>(createInfo.maxSets);
+        std::vector<vk::DescriptorPoolSize> tmpPoolSizes = scale(poolSizes, factor);
+        vk::DescriptorPoolCreateInfo tmpCreateInfo = createInfo;
+        tmpCreateInfo.setMaxSets(nextMaxSets);
+        tmpCreateInfo.setPoolSizes(tmpPoolSizes);
+        std::shared_ptr<vk::raii::DescriptorPool> result = std::make_shared<vk::raii::DescriptorPool>(target, tmpCreateInfo);
+        poolCreateCount++;
+        nextMaxSets = std::min<uint32_t>(static_cast<uint32_t>(std::ceil(nextMaxSets * growthFactor)), maxSetsLimit);
+        return result;
+      }
+
+  };
+
+  class DescriptorAllocator::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::vector<vk::DescriptorPoolSize> poolSizes;
+      std::optional<vk::DescriptorPoolCreateInfo> createInfo;
+      std::optional<double> growthFactor;
+      std::optional<uint32_t> maxSetsLimit;
+      std::optional<size_t> frameCount;
+
+    public:
+
+      DescriptorAllocator::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& addPoolSize(const vk::DescriptorPoolSize& val) {
+        poolSizes.emplace_back(val);
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& setPoolSizes(const std::vector<vk::DescriptorPoolSize>& val) {
+        poolSizes = val;
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& setCreateInfo(const vk::DescriptorPoolCreateInfo& val) {
+        createInfo = val;
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& setGrowthFactor(const double& val) {
+        growthFactor = val;
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& setMaxSetsLimit(const uint32_t& val) {
+        maxSetsLimit = val;
+        return *this;
+      }
+
+      DescriptorAllocator::Builder& setFrameCount(const size_t& val) {
+        frameCount = val;
+        return *this;
+      }
+
+      DescriptorAllocator build() {
+        try {
+          DescriptorAllocator target = {};
+          target.device = device;
+          target.poolSizes = poolSizes;
+          if (target.poolSizes.empty()) {
+            throw std::runtime_error(CALL_INFO() + ": poolSizes is empty!");
+          }
+          target.createInfo = createInfo.value_or(vk::DescriptorPoolCreateInfo().setMaxSets(64));
+          if (target.createInfo.maxSets == 0) {
+            throw std::runtime_error(CALL_INFO() + ": createInfo.maxSets is zero!");
+          }
+          target.createInfo.setPoolSizes(target.poolSizes);
+          target.growthFactor = std::max(growthFactor.value_or(1.5), 1.0);
+          target.maxSetsLimit = std::max(maxSetsLimit.value_or(4096), target.createInfo.maxSets);
+          target.nextMaxSets = target.createInfo.maxSets;
+          target.frames.resize(std::max<size_t>(frameCount.value_or(1), 1));
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  DescriptorAllocator::Builder DescriptorAllocator::builder() {
+    return {};
+  }
+
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <vector>
 #include <memory>
+#include <functional>
 #include <stdexcept>
 
 #include <vulkan/vulkan_raii.hpp>
@@ -44,6 +47,7 @@ namespace exqudens::vulkan {
       std::vector<vk::DescriptorSetLayout> setLayouts;
       std::optional<vk::DescriptorSetAllocateInfo> createInfo;
       std::vector<WriteDescriptorSet> writes;
+      std::function<std::vector<WriteDescriptorSet>(const size_t&)> writesFunction;
 
     public:
 
@@ -72,6 +76,11 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      DescriptorSet::Builder& setWritesFunction(const std::function<std::vector<WriteDescriptorSet>(const size_t&)>& val) {
+        writesFunction = val;
+        return *this;
+      }
+
       DescriptorSet build() {
         try {
           DescriptorSet target = {};
@@ -96,6 +105,52 @@ namespace exqudens::vulkan {
         }
       }
 
+      std::vector<DescriptorSet> buildAll(const uint32_t& count) {
+        try {
+          std::vector<vk::DescriptorSetLayout> tmpSetLayouts = {};
+          if (setLayouts.size() == 1) {
+            tmpSetLayouts = std::vector<vk::DescriptorSetLayout>(count, setLayouts.front());
+          } else if (setLayouts.size() == count) {
+            tmpSetLayouts = setLayouts;
+          } else {
+            throw std::runtime_error(CALL_INFO() + ": setLayouts size must be 1 or equal to count!");
+          }
+
+          vk::DescriptorSetAllocateInfo tmpCreateInfo = createInfo.value();
+          tmpCreateInfo.setSetLayouts(tmpSetLayouts);
+          vk::raii::DescriptorSets values = vk::raii::DescriptorSets(
+              *device.lock(),
+              tmpCreateInfo
+          );
+
+          std::vector<DescriptorSet> targets = {};
+          targets.reserve(values.size());
+          for (size_t i = 0; i < values.size(); i++) {
+            DescriptorSet target = {};
+            target.setLayouts = {tmpSetLayouts[i]};
+            target.createInfo = tmpCreateInfo;
+            target.value = std::make_shared<vk::raii::DescriptorSet>(std::move(values[i]));
+            target.writes = writesFunction ? writesFunction(i) : writes;
+            for (WriteDescriptorSet& write : target.writes) {
+              write.setDstSet(*target.reference());
+            }
+            targets.emplace_back(target);
+          }
+
+          std::vector<vk::WriteDescriptorSet> tmpWrites;
+          for (DescriptorSet& target : targets) {
+            target.createInfo.setSetLayouts(target.setLayouts);
+            tmpWrites.insert(tmpWrites.end(), target.writes.begin(), target.writes.end());
+          }
+          if (!tmpWrites.empty()) {
+            device.lock()->updateDescriptorSets(tmpWrites, {});
+          }
+          return targets;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
   DescriptorSet::Builder DescriptorSet::builder() {
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/WriteDescriptorSet.hpp"
+
+namespace exqudens::vulkan {
+
+  struct DescriptorSetCache {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Entry {
+
+      vk::DescriptorSetLayout setLayout;
+      std::vector<WriteDescriptorSet> writes;
+      std::shared_ptr<vk::raii::DescriptorPool> pool;
+      vk::DescriptorSet value;
+      uint64_t lastFrame = 0;
+
+    };
+
+    static size_t hash(const vk::DescriptorSetLayout& setLayout, const std::vector<WriteDescriptorSet>& writes) {
+      try {
+        size_t result = handle(setLayout);
+        auto combine = [&result](const size_t& value) {
+          result ^= value + 0x9E3779B9 + (result << 6) + (result >> 2);
+        };
+        for (const WriteDescriptorSet& write : writes) {
+          combine(write.dstBinding);
+          combine(write.dstArrayElement);
+          combine(write.descriptorCount);
+          combine(static_cast<size_t>(write.descriptorType));
+          for (const vk::DescriptorImageInfo& info : write.imageInfo) {
+            combine(handle(info.sampler));
+            combine(handle(info.imageView));
+            combine(static_cast<size_t>(info.imageLayout));
+          }
+          for (const vk::DescriptorBufferInfo& info : write.bufferInfo) {
+            combine(handle(info.buffer));
+            combine(static_cast<size_t>(info.offset));
+            combine(static_cast<size_t>(info.range));
+          }
+          for (const vk::BufferView& bufferView : write.texelBufferView) {
+            combine(handle(bufferView));
+          }
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static bool equals(const std::vector<WriteDescriptorSet>& writes1, const std::vector<WriteDescriptorSet>& writes2) {
+      try {
+        return std::ranges::equal(writes1, writes2, [](const WriteDescriptorSet& o1, const WriteDescriptorSet& o2) {
+          return o1.dstBinding == o2.dstBinding
+              && o1.dstArrayElement == o2.dstArrayElement
+              && o1.descriptorCount == o2.descriptorCount
+              && o1.descriptorType == o2.descriptorType
+              && o1.imageInfo == o2.imageInfo
+              && o1.bufferInfo == o2.bufferInfo
+              && o1.texelBufferView == o2.texelBufferView;
+        });
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::vector<vk::DescriptorPoolSize> poolSizes;
+    vk::DescriptorPoolCreateInfo poolCreateInfo;
+    std::vector<std::shared_ptr<vk::raii::DescriptorPool>> pools;
+    std::map<size_t, std::vector<Entry>> entries;
+    uint64_t maxUnusedFrames = 0;
+    uint64_t frame = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictCount = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    vk::DescriptorSet get(const vk::DescriptorSetLayout& setLayout, const std::vector<WriteDescriptorSet>& writes) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::vector<Entry>& bucket = entries[hash(setLayout, writes)];
+        auto it = std::ranges::find_if(bucket, [&setLayout, &writes](const Entry& o) {
+          return o.setLayout == setLayout && equals(o.writes, writes);
+        });
+        if (it != bucket.end()) {
+          hitCount++;
+          it->lastFrame = frame;
+          return it->value;
+        }
+        missCount++;
+        Entry entry = {};
+        entry.setLayout = setLayout;
+        entry.writes = writes;
+        entry.lastFrame = frame;
+        allocate(entry);
+        std::vector<vk::WriteDescriptorSet> tmpWrites;
+        for (WriteDescriptorSet& write : entry.writes) {
+          write.setDstSet(entry.value);
+          tmpWrites.emplace_back(write);
+        }
+        if (!tmpWrites.empty()) {
+          device.lock()->updateDescriptorSets(tmpWrites, {});
+        }
+        bucket.emplace_back(entry);
+        return entry.value;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void beginFrame() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        frame++;
+        for (auto it = entries.begin(); it != entries.end();) {
+          std::erase_if(it->second, [this](const Entry& o) {
+            if (frame - o.lastFrame <= maxUnusedFrames) {
+              return false;
+            }
+            release(o);
+            evictCount++;
+            return true;
+          });
+          it = it->second.empty() ? entries.erase(it) : std::next(it);
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    double hitRate() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        uint64_t total = hitCount + missCount;
+        return total == 0 ? 0.0 : static_cast<double>(hitCount) / static_cast<double>(total);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    size_t size() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        size_t result = 0;
+        for (const auto& [key, bucket] : entries) {
+          result += bucket.size();
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void clear() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        for (std::shared_ptr<vk::raii::DescriptorPool>& pool : pools) {
+          pool->reset();
+        }
+        entries.clear();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      template<typename T>
+      static size_t handle(const T& value) {
+        return std::hash<typename T::CType>()(static_cast<typename T::CType>(value));
+      }
+
+      void allocate(Entry& entry) {
+        std::shared_ptr<vk::raii::Device> sharedDevice = device.lock();
+        for (size_t i = pools.size(); i-- > 0;) {
+          if (allocate(*sharedDevice, pools[i], entry)) {
+            return;
+          }
+        }
+        vk::DescriptorPoolCreateInfo tmpCreateInfo = poolCreateInfo;
+        tmpCreateInfo.setPoolSizes(poolSizes);
+        pools.emplace_back(std::make_shared<vk::raii::DescriptorPool>(*sharedDevice, tmpCreateInfo));
+        if (!allocate(*sharedDevice, pools.back(), entry)) {
+          throw std::runtime_error(CALL_INFO() + ": failed to allocate descriptor set from a new pool!");
+        }
+      }
+
+      bool allocate(vk::raii::Device& target, const std::shared_ptr<vk::raii::DescriptorPool>& pool, Entry& entry) {
+        VkDescriptorSet value = VK_NULL_HANDLE;
+        vk::DescriptorSetAllocateInfo allocateInfo = vk::DescriptorSetAllocateInfo()
+            .setDescriptorPool(**pool)
+            .setSetLayouts(entry.setLayout);
+        vk::Result result = static_cast<vk::Result>(target.getDispatcher()->vkAllocateDescriptorSets(
+            static_cast<VkDevice>(*target),
+            reinterpret_cast<const VkDescriptorSetAllocateInfo*>(&allocateInfo),
+            &value
+        ));
+        if (vk::Result::eSuccess == result) {
+          entry.pool = pool;
+          entry.value = value;
+          return true;
+        } else if (vk::Result::eErrorOutOfPoolMemory != result && vk::Result::eErrorFragmentedPool != result) {
+          throw std::runtime_error(CALL_INFO() + ": failed to allocate descriptor set: " + vk::to_string(result) + "!");
+        }
+        return false;
+      }
+
+      void release(const Entry& entry) {
+        std::shared_ptr<vk::raii::Device> sharedDevice = device.lock();
+        VkDescriptorSet value = static_cast<VkDescriptorSet>(entry.value);
+        sharedDevice->getDispatcher()->vkFreeDescriptorSets(
+            static_cast<VkDevice>(**sharedDevice),
+            static_cast<VkDescriptorPool>(**entry.pool),
+            1,
+            &value
+        );
+      }
+
+  };
+
+  class DescriptorSetCache::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::vector<vk::DescriptorPoolSize> poolSizes;
+      std::optional<vk::DescriptorPoolCreateInfo> poolCreateInfo;
+      std::optional<uint64_t> maxUnusedFrames;
+
+    public:
+
+      DescriptorSetCache::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      DescriptorSetCache::Builder& addPoolSize(const vk::DescriptorPoolSize& val) {
+        poolSizes.emplace_back(val);
+        return *this;
+      }
+
+      DescriptorSetCache::Builder& setPoolSizes(const std::vector<vk::DescriptorPoolSize>& val) {
+        poolSizes = val;
+        return *this;
+      }
+
+      DescriptorSetCache::Builder& setPoolCreateInfo(const vk::DescriptorPoolCreateInfo& val) {
+        poolCreateInfo = val;
+        return *this;
+      }
+
+      // must be at least the number of frames in flight, evicted sets are freed without waiting for the gpu
+      DescriptorSetCache::Builder& setMaxUnusedFrames(const uint64_t& val) {
+        maxUnusedFrames = val;
+        return *this;
+      }
+
+      DescriptorSetCache build() {
+        try {
+          DescriptorSetCache target = {};
+          target.device = device;
+          target.poolSizes = poolSizes;
+          if (target.poolSizes.empty()) {
+            throw std::runtime_error(CALL_INFO() + ": poolSizes is empty!");
+          }
+          target.poolCreateInfo = poolCreateInfo.value_or(vk::DescriptorPoolCreateInfo().setMaxSets(256));
+          target.poolCreateInfo.setFlags(target.poolCreateInfo.flags | vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet);
+          if (target.poolCreateInfo.maxSets == 0) {
+            throw std::runtime_error(CALL_INFO() + ": poolCreateInfo.maxSets is zero!");
+          }
+          target.maxUnusedFrames = maxUnusedFrames.value_or(8);
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  DescriptorSetCache::Builder DescriptorSetCache::builder() {
+    return {};
+  }
+
+}
@@ -7,6 +7,7 @@
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Device.hpp"
 
 namespace exqudens::vulkan {
 
@@ -16,8 +17,17 @@ namespace exqudens::vulkan {
 
     static Builder builder();
 
+    static bool isPushDescriptorSupported(const Device& device) {
+      try {
+        return device.isExtensionEnabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
     std::vector<vk::DescriptorSetLayoutBinding> bindings;
     vk::DescriptorSetLayoutCreateInfo createInfo;
+    bool pushDescriptor = false;
     std::shared_ptr<vk::raii::DescriptorSetLayout> value;
 
     vk::raii::DescriptorSetLayout& reference() {
@@ -40,6 +50,8 @@ namespace exqudens::vulkan {
       std::weak_ptr<vk::raii::Device> device;
       std::vector<vk::DescriptorSetLayoutBinding> bindings;
       std::optional<vk::DescriptorSetLayoutCreateInfo> createInfo;
+      std::optional<bool> pushDescriptor;
+      std::optional<bool> pushDescriptorSupported;
 
     public:
 
@@ -63,12 +75,27 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      DescriptorSetLayout::Builder& setPushDescriptor(const bool& val) {
+        pushDescriptor = val;
+        return *this;
+      }
+
+      DescriptorSetLayout::Builder& setPushDescriptorSupported(const bool& val) {
+        pushDescriptorSupported = val;
+        return *this;
+      }
+
       DescriptorSetLayout build() {
         try {
           DescriptorSetLayout target = {};
           target.bindings = bindings;
           target.createInfo = createInfo.value_or(vk::DescriptorSetLayoutCreateInfo());
           target.createInfo.setBindings(target.bindings);
+          target.pushDescriptor = static_cast<bool>(target.createInfo.flags & vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR)
+              || (pushDescriptor.value_or(false) && pushDescriptorSupported.value_or(false));
+          if (target.pushDescriptor) {
+            target.createInfo.setFlags(target.createInfo.flags | vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR);
+          }
           target.value = std::make_shared<vk::raii::DescriptorSetLayout>(
               *device.lock(),
               target.createInfo
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/DescriptorSetLayout.hpp"
+
+namespace exqudens::vulkan {
+
+  struct DescriptorSetLayoutCache {
+
+    class Builder;
+
+    static Builder builder();
+
+    static size_t hash(const std::vector<vk::DescriptorSetLayoutBinding>& bindings, const vk::DescriptorSetLayoutCreateFlags& flags = {}) {
+      try {
+        size_t result = static_cast<size_t>(static_cast<VkDescriptorSetLayoutCreateFlags>(flags));
+        for (const vk::DescriptorSetLayoutBinding& binding : bindings) {
+          for (size_t value : {
+              static_cast<size_t>(binding.binding),
+              static_cast<size_t>(binding.descriptorType),
+              static_cast<size_t>(binding.descriptorCount),
+              static_cast<size_t>(static_cast<VkShaderStageFlags>(binding.stageFlags))
+          }) {
+            result ^= value + 0x9E3779B9 + (result << 6) + (result >> 2);
+          }
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::map<size_t, std::vector<DescriptorSetLayout>> layouts;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    DescriptorSetLayout get(std::vector<vk::DescriptorSetLayoutBinding> bindings, const vk::DescriptorSetLayoutCreateFlags& flags = {}) {
+      try {
+        std::ranges::sort(bindings, {}, &vk::DescriptorSetLayoutBinding::binding);
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::vector<DescriptorSetLayout>& bucket = layouts[hash(bindings, flags)];
+        auto it = std::ranges::find_if(bucket, [&bindings, &flags](const DescriptorSetLayout& o) {
+          return o.bindings == bindings && o.createInfo.flags == flags;
+        });
+        if (it == bucket.end()) {
+          missCount++;
+          bucket.emplace_back(
+              DescriptorSetLayout::builder()
+                  .setDevice(device)
+                  .setBindings(bindings)
+                  .setCreateInfo(vk::DescriptorSetLayoutCreateInfo().setFlags(flags))
+              .build()
+          );
+          it = bucket.end() - 1;
+        } else {
+          hitCount++;
+        }
+        DescriptorSetLayout result = *it;
+        result.createInfo.setBindings(result.bindings);
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    size_t size() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        size_t result = 0;
+        for (const auto& [key, bucket] : layouts) {
+          result += bucket.size();
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void clear() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        layouts.clear();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class DescriptorSetLayoutCache::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+
+    public:
+
+      DescriptorSetLayoutCache::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      DescriptorSetLayoutCache build() {
+        try {
+          DescriptorSetLayoutCache target = {};
+          target.device = device;
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  DescriptorSetLayoutCache::Builder DescriptorSetLayoutCache::builder() {
+    return {};
+  }
+
+}
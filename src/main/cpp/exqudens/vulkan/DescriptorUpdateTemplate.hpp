@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/DescriptorSetLayout.hpp"
+
+namespace exqudens::vulkan {
+
+  struct DescriptorUpdateTemplate {
+
+    class Builder;
+
+    static Builder builder();
+
+    static size_t stride(const vk::DescriptorType& type) {
+      try {
+        switch (type) {
+          case vk::DescriptorType::eSampler:
+          case vk::DescriptorType::eCombinedImageSampler:
+          case vk::DescriptorType::eSampledImage:
+          case vk::DescriptorType::eStorageImage:
+          case vk::DescriptorType::eInputAttachment:
+            return sizeof(vk::DescriptorImageInfo);
+          case vk::DescriptorType::eUniformBuffer:
+          case vk::DescriptorType::eStorageBuffer:
+          case vk::DescriptorType::eUniformBufferDynamic:
+          case vk::DescriptorType::eStorageBufferDynamic:
+            return sizeof(vk::DescriptorBufferInfo);
+          case vk::DescriptorType::eUniformTexelBuffer:
+          case vk::DescriptorType::eStorageTexelBuffer:
+            return sizeof(vk::BufferView);
+          default:
+            throw std::invalid_argument(CALL_INFO() + ": unsupported descriptor type: " + vk::to_string(type) + "!");
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static std::vector<vk::DescriptorUpdateTemplateEntry> layoutEntries(std::vector<vk::DescriptorSetLayoutBinding> bindings, const size_t& offset = 0) {
+      try {
+        std::ranges::sort(bindings, {}, &vk::DescriptorSetLayoutBinding::binding);
+        std::vector<vk::DescriptorUpdateTemplateEntry> result;
+        size_t currentOffset = offset;
+        for (const vk::DescriptorSetLayoutBinding& binding : bindings) {
+          if (binding.descriptorCount == 0) {
+            continue;
+          }
+          size_t currentStride = stride(binding.descriptorType);
+          result.emplace_back(
+              vk::DescriptorUpdateTemplateEntry()
+                  .setDstBinding(binding.binding)
+                  .setDstArrayElement(0)
+                  .setDescriptorCount(binding.descriptorCount)
+                  .setDescriptorType(binding.descriptorType)
+                  .setOffset(currentOffset)
+                  .setStride(currentStride)
+          );
+          currentOffset += currentStride * binding.descriptorCount;
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static size_t dataSize(const std::vector<vk::DescriptorUpdateTemplateEntry>& entries) {
+      try {
+        size_t result = 0;
+        for (const vk::DescriptorUpdateTemplateEntry& entry : entries) {
+          if (entry.descriptorCount == 0) {
+            continue;
+          }
+          result = std::max(result, entry.offset + entry.stride * (entry.descriptorCount - 1) + stride(entry.descriptorType));
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::vector<vk::DescriptorUpdateTemplateEntry> entries;
+    vk::DescriptorUpdateTemplateCreateInfo createInfo;
+    size_t size = 0;
+    std::shared_ptr<vk::raii::DescriptorUpdateTemplate> value;
+
+    vk::raii::DescriptorUpdateTemplate& reference() {
+      try {
+        if (!value) {
+          throw std::runtime_error(CALL_INFO() + ": value is not initialized!");
+        }
+        return *value;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void update(const vk::DescriptorSet& descriptorSet, const void* data) {
+      try {
+        std::shared_ptr<vk::raii::Device> sharedDevice = device.lock();
+        sharedDevice->getDispatcher()->vkUpdateDescriptorSetWithTemplate(
+            static_cast<VkDevice>(**sharedDevice),
+            static_cast<VkDescriptorSet>(descriptorSet),
+            static_cast<VkDescriptorUpdateTemplate>(*reference()),
+            data
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    template<typename T>
+    void update(const vk::DescriptorSet& descriptorSet, const T& data) {
+      static_assert(std::is_trivially_copyable_v<T>, "data must be trivially copyable");
+      try {
+        if (sizeof(T) < size) {
+          throw std::invalid_argument(CALL_INFO() + ": data size: " + std::to_string(sizeof(T)) + " is less than template size: " + std::to_string(size) + "!");
+        }
+        update(descriptorSet, static_cast<const void*>(&data));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class DescriptorUpdateTemplate::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::vector<vk::DescriptorSetLayoutBinding> bindings;
+      std::vector<vk::DescriptorUpdateTemplateEntry> entries;
+      std::optional<vk::DescriptorSetLayout> setLayout;
+      std::optional<vk::DescriptorUpdateTemplateCreateInfo> createInfo;
+
+    public:
+
+      DescriptorUpdateTemplate::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& setDescriptorSetLayout(const DescriptorSetLayout& val) {
+        bindings = val.bindings;
+        setLayout = *(*val.value);
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& setBindings(const std::vector<vk::DescriptorSetLayoutBinding>& val) {
+        bindings = val;
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& setSetLayout(const vk::DescriptorSetLayout& val) {
+        setLayout = val;
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& addEntry(const vk::DescriptorUpdateTemplateEntry& val) {
+        entries.emplace_back(val);
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& setEntries(const std::vector<vk::DescriptorUpdateTemplateEntry>& val) {
+        entries = val;
+        return *this;
+      }
+
+      DescriptorUpdateTemplate::Builder& setCreateInfo(const vk::DescriptorUpdateTemplateCreateInfo& val) {
+        createInfo = val;
+        return *this;
+      }
+
+      // requires a Vulkan 1.1 device or one with VK_KHR_descriptor_update_template enabled
+      DescriptorUpdateTemplate build() {
+        try {
+          const vk::raii::DeviceDispatcher* dispatcher = device.lock()->getDispatcher();
+          if (dispatcher->vkCreateDescriptorUpdateTemplate == nullptr || dispatcher->vkUpdateDescriptorSetWithTemplate == nullptr) {
+            throw std::runtime_error(CALL_INFO() + ": descriptor update templates are not available, use a Vulkan 1.1 device or enable '" + VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME + "'!");
+          }
+          DescriptorUpdateTemplate target = {};
+          target.device = device;
+          target.entries = entries.empty() ? DescriptorUpdateTemplate::layoutEntries(bindings) : entries;
+          if (target.entries.empty()) {
+            throw std::runtime_error(CALL_INFO() + ": entries is empty!");
+          }
+          target.size = DescriptorUpdateTemplate::dataSize(target.entries);
+          target.createInfo = createInfo.value_or(
+              vk::DescriptorUpdateTemplateCreateInfo()
+                  .setTemplateType(vk::DescriptorUpdateTemplateType::eDescriptorSet)
+          );
+          target.createInfo.setDescriptorUpdateEntries(target.entries);
+          if (setLayout) {
+            target.createInfo.setDescriptorSetLayout(setLayout.value());
+          }
+          target.value = std::make_shared<vk::raii::DescriptorUpdateTemplate>(
+              *device.lock(),
+              target.createInfo
+          );
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  DescriptorUpdateTemplate::Builder DescriptorUpdateTemplate::builder() {
+    return {};
+  }
+
+}
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <string>
 #include <optional>
+#include <vector>
 #include <memory>
+#include <algorithm>
 #include <stdexcept>
 
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/PhysicalDevice.hpp"
 
 namespace exqudens::vulkan {
 
@@ -17,6 +21,7 @@ namespace exqudens::vulkan {
     static Builder builder();
 
     vk::DeviceCreateInfo createInfo;
+    std::vector<std::string> enabledExtensionNames;
     std::shared_ptr<vk::raii::Device> value;
 
     vk::raii::Device& reference() {
@@ -30,6 +35,14 @@ namespace exqudens::vulkan {
       }
     }
 
+    bool isExtensionEnabled(const std::string& name) const {
+      try {
+        return std::ranges::find(enabledExtensionNames, name) != enabledExtensionNames.end();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Device::Builder {
@@ -37,6 +50,7 @@ namespace exqudens::vulkan {
     private:
 
       std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      void* featuresChain = nullptr;
       std::optional<vk::DeviceCreateInfo> createInfo;
 
     public:
@@ -46,6 +60,13 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      // also enables the descriptor indexing and dynamic rendering features requested on the physical device
+      Device::Builder& setPhysicalDevice(PhysicalDevice& val) {
+        physicalDevice = val.value;
+        featuresChain = val.featuresChain();
+        return *this;
+      }
+
       Device::Builder& setCreateInfo(const vk::DeviceCreateInfo& val) {
         createInfo = val;
         return *this;
@@ -55,6 +76,18 @@ namespace exqudens::vulkan {
         try {
           Device target = {};
           target.createInfo = createInfo.value();
+          if (featuresChain != nullptr) {
+            VkBaseOutStructure* last = reinterpret_cast<VkBaseOutStructure*>(featuresChain);
+            while (last->pNext != nullptr) {
+              last = last->pNext;
+            }
+            last->pNext = reinterpret_cast<VkBaseOutStructure*>(const_cast<void*>(target.createInfo.pNext));
+            target.createInfo.setPNext(featuresChain);
+          }
+          target.enabledExtensionNames = std::vector<std::string>(
+              target.createInfo.ppEnabledExtensionNames,
+              target.createInfo.ppEnabledExtensionNames + target.createInfo.enabledExtensionCount
+          );
           target.value = std::make_shared<vk::raii::Device>(
               *physicalDevice.lock(),
               target.createInfo
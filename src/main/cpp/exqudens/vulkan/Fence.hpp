@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <memory>
 #include <stdexcept>
@@ -7,6 +8,7 @@
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
 
 namespace exqudens::vulkan {
 
@@ -16,6 +18,8 @@ namespace exqudens::vulkan {
 
     static Builder builder();
 
+    std::weak_ptr<vk::raii::Device> device;
+    std::weak_ptr<Tracer> tracer;
     vk::FenceCreateInfo createInfo;
     std::shared_ptr<vk::raii::Fence> value;
 
@@ -30,6 +34,23 @@ namespace exqudens::vulkan {
       }
     }
 
+    vk::Result wait(const uint64_t& timeout = UINT64_MAX) {
+      try {
+        TRACE_SCOPE(tracer, "fenceWait");
+        return device.lock()->waitForFences({*reference()}, true, timeout);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void reset() {
+      try {
+        device.lock()->resetFences({*reference()});
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Fence::Builder {
@@ -37,6 +58,7 @@ namespace exqudens::vulkan {
     private:
 
       std::weak_ptr<vk::raii::Device> device;
+      std::weak_ptr<Tracer> tracer;
       std::optional<vk::FenceCreateInfo> createInfo;
 
     public:
@@ -46,6 +68,11 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Fence::Builder& setTracer(const std::weak_ptr<Tracer>& val) {
+        tracer = val;
+        return *this;
+      }
+
       Fence::Builder& setCreateInfo(const vk::FenceCreateInfo& val) {
         createInfo = val;
         return *this;
@@ -54,6 +81,8 @@ namespace exqudens::vulkan {
       Fence build() {
         try {
           Fence target = {};
+          target.device = device;
+          target.tracer = tracer;
           target.createInfo = createInfo.value_or(vk::FenceCreateInfo());
           target.value = std::make_shared<vk::raii::Fence>(
               *device.lock(),
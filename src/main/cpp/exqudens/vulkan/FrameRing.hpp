@@ -0,0 +1,341 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <array>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
+#include "exqudens/vulkan/Semaphore.hpp"
+#include "exqudens/vulkan/Fence.hpp"
+#include "exqudens/vulkan/Queue.hpp"
+#include "exqudens/vulkan/Swapchain.hpp"
+#include "exqudens/vulkan/CommandBuffer.hpp"
+#include "exqudens/vulkan/OffscreenTarget.hpp"
+
+namespace exqudens::vulkan {
+
+  template<size_t N>
+  struct FrameRing {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Frame {
+
+      Semaphore imageAvailableSemaphore;
+      Semaphore renderFinishedSemaphore;
+      Fence inFlightFence;
+      CommandBuffer commandBuffer;
+      std::chrono::nanoseconds waitTime;
+
+    };
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::weak_ptr<Tracer> tracer;
+    std::array<Frame, N> frames;
+    size_t currentFrame = 0;
+    uint32_t imageIndex = 0;
+    uint64_t frameNumber = 0;
+    std::vector<std::pair<uint64_t, std::shared_ptr<void>>> retired;
+
+    Frame& current() {
+      return frames[currentFrame];
+    }
+
+    vk::raii::CommandBuffer& commandBufferReference() {
+      try {
+        return current().commandBuffer.reference();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result begin(vk::raii::SwapchainKHR& swapchain) {
+      try {
+        return beginFrame(swapchain);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result begin(Swapchain& swapchain) {
+      try {
+        return beginFrame(swapchain);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result begin(OffscreenTarget& offscreenTarget) {
+      try {
+        return beginFrame(offscreenTarget);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void submit(
+        vk::raii::Queue& queue,
+        const vk::PipelineStageFlags& waitDstStage = vk::PipelineStageFlagBits::eColorAttachmentOutput
+    ) {
+      try {
+        submitFrame(queue, waitDstStage);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void submit(
+        Queue& queue,
+        const vk::PipelineStageFlags& waitDstStage = vk::PipelineStageFlagBits::eColorAttachmentOutput
+    ) {
+      try {
+        submitFrame(queue, waitDstStage);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result present(OffscreenTarget& offscreenTarget) {
+      try {
+        TRACE_SCOPE(tracer, "present");
+        Frame& frame = current();
+        currentFrame = (currentFrame + 1) % N;
+        return offscreenTarget.present({*frame.renderFinishedSemaphore.reference()}, imageIndex);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result present(vk::raii::Queue& queue, vk::raii::SwapchainKHR& swapchain) {
+      try {
+        TRACE_SCOPE(tracer, "present");
+        Frame& frame = current();
+        currentFrame = (currentFrame + 1) % N;
+
+        std::vector<vk::Semaphore> waitSemaphores = {*frame.renderFinishedSemaphore.reference()};
+        std::vector<vk::SwapchainKHR> swapchains = {*swapchain};
+        std::vector<uint32_t> imageIndices = {imageIndex};
+
+        try {
+          return queue.presentKHR(
+              vk::PresentInfoKHR()
+                  .setWaitSemaphores(waitSemaphores)
+                  .setSwapchains(swapchains)
+                  .setImageIndices(imageIndices)
+          );
+        } catch (const vk::OutOfDateKHRError&) {
+          return vk::Result::eErrorOutOfDateKHR;
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result present(Queue& queue, Swapchain& swapchain) {
+      try {
+        TRACE_SCOPE(tracer, "present");
+        Frame& frame = current();
+        currentFrame = (currentFrame + 1) % N;
+
+        std::vector<vk::Semaphore> waitSemaphores = {*frame.renderFinishedSemaphore.reference()};
+        std::vector<vk::SwapchainKHR> swapchains = {*swapchain.reference()};
+        std::vector<uint32_t> imageIndices = {imageIndex};
+
+        return queue.present(
+            vk::PresentInfoKHR()
+                .setWaitSemaphores(waitSemaphores)
+                .setSwapchains(swapchains)
+                .setImageIndices(imageIndices)
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    // released once N more frames are submitted, so retiring while the current frame records is safe
+    template<typename T>
+    void retire(const std::shared_ptr<T>& value) {
+      try {
+        if (value) {
+          retired.emplace_back(frameNumber, std::static_pointer_cast<void>(value));
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void releaseRetired() {
+      try {
+        std::erase_if(retired, [this](const std::pair<uint64_t, std::shared_ptr<void>>& entry) {
+          return entry.first + N <= frameNumber;
+        });
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::chrono::nanoseconds averageWaitTime() {
+      std::chrono::nanoseconds sum = std::chrono::nanoseconds::zero();
+      for (const Frame& frame : frames) {
+        sum += frame.waitTime;
+      }
+      return sum / N;
+    }
+
+    private:
+
+      template<typename T>
+      void submitFrame(T& queue, const vk::PipelineStageFlags& waitDstStage) {
+        try {
+          TRACE_SCOPE(tracer, "submit");
+          Frame& frame = current();
+          frame.commandBuffer.reference().end();
+
+          std::vector<vk::PipelineStageFlags> waitDstStageMask = {waitDstStage};
+          std::vector<vk::Semaphore> waitSemaphores = {*frame.imageAvailableSemaphore.reference()};
+          std::vector<vk::Semaphore> signalSemaphores = {*frame.renderFinishedSemaphore.reference()};
+          std::vector<vk::CommandBuffer> commandBuffers = {*frame.commandBuffer.reference()};
+
+          queue.submit(
+              {
+                  vk::SubmitInfo()
+                      .setWaitDstStageMask(waitDstStageMask)
+                      .setWaitSemaphores(waitSemaphores)
+                      .setSignalSemaphores(signalSemaphores)
+                      .setCommandBuffers(commandBuffers)
+              },
+              *frame.inFlightFence.reference()
+          );
+          frameNumber++;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      template<typename T>
+      vk::Result beginFrame(T& target) {
+        try {
+          Frame& frame = current();
+
+          auto waitBegin = std::chrono::steady_clock::now();
+          vk::Result result = device.lock()->waitForFences(
+              {*frame.inFlightFence.reference()},
+              true,
+              UINT64_MAX
+          );
+          auto waitEnd = std::chrono::steady_clock::now();
+          frame.waitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(waitEnd - waitBegin);
+          TRACE_RECORD(tracer, "fenceWait", waitBegin, waitEnd);
+          if (vk::Result::eSuccess != result) {
+            throw std::runtime_error(CALL_INFO() + ": failed to 'device.waitForFences(...)'!");
+          }
+          releaseRetired();
+
+          try {
+            TRACE_SCOPE(tracer, "acquire");
+            std::pair<vk::Result, uint32_t> pair = target.acquireNextImage(
+                UINT64_MAX,
+                *frame.imageAvailableSemaphore.reference()
+            );
+            result = pair.first;
+            imageIndex = pair.second;
+          } catch (const vk::OutOfDateKHRError&) {
+            return vk::Result::eErrorOutOfDateKHR;
+          }
+          if (vk::Result::eSuccess != result && vk::Result::eSuboptimalKHR != result) {
+            throw std::runtime_error(CALL_INFO() + ": failed to 'acquireNextImage(...)'!");
+          }
+
+          device.lock()->resetFences({*frame.inFlightFence.reference()});
+          frame.commandBuffer.reference().reset();
+          frame.commandBuffer.reference().begin({});
+          return result;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  template<size_t N>
+  class FrameRing<N>::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::weak_ptr<Tracer> tracer;
+      std::optional<vk::CommandPool> commandPool;
+
+    public:
+
+      FrameRing<N>::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      FrameRing<N>::Builder& setTracer(const std::weak_ptr<Tracer>& val) {
+        tracer = val;
+        return *this;
+      }
+
+      FrameRing<N>::Builder& setCommandPool(const vk::CommandPool& val) {
+        commandPool = val;
+        return *this;
+      }
+
+      FrameRing<N> build() {
+        try {
+          FrameRing<N> target = {};
+          target.device = device;
+          target.tracer = tracer;
+          std::vector<CommandBuffer> commandBuffers = CommandBuffer::builder()
+              .setDevice(device)
+              .setCreateInfo(
+                  vk::CommandBufferAllocateInfo()
+                      .setCommandPool(commandPool.value())
+                      .setLevel(vk::CommandBufferLevel::ePrimary)
+              )
+          .buildAll(static_cast<uint32_t>(N));
+          for (size_t i = 0; i < N; i++) {
+            Frame& frame = target.frames[i];
+            frame.imageAvailableSemaphore = Semaphore::builder()
+                .setDevice(device)
+            .build();
+            frame.renderFinishedSemaphore = Semaphore::builder()
+                .setDevice(device)
+            .build();
+            frame.inFlightFence = Fence::builder()
+                .setDevice(device)
+                .setCreateInfo(
+                    vk::FenceCreateInfo()
+                        .setFlags(vk::FenceCreateFlagBits::eSignaled)
+                )
+            .build();
+            frame.commandBuffer = commandBuffers[i];
+            frame.waitTime = std::chrono::nanoseconds::zero();
+          }
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  template<size_t N>
+  typename FrameRing<N>::Builder FrameRing<N>::builder() {
+    return {};
+  }
+
+}
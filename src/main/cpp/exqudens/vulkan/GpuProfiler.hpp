@@ -0,0 +1,421 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <string>
+#include <optional>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
+
+namespace exqudens::vulkan {
+
+  struct GpuProfiler {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Stats {
+
+      uint64_t count = 0;
+      double min = 0;
+      double avg = 0;
+      double p99 = 0;
+
+    };
+
+    struct Samples {
+
+      std::vector<double> values;
+      size_t next = 0;
+      uint64_t count = 0;
+
+    };
+
+    class Scope {
+
+      public:
+
+        Scope(GpuProfiler& profiler, vk::raii::CommandBuffer& commandBuffer, const std::string& name):
+            profiler(&profiler),
+            commandBuffer(&commandBuffer),
+            index(profiler.begin(commandBuffer, name))
+        {
+        }
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope() {
+          try {
+            profiler->end(*commandBuffer, index);
+          } catch (...) {
+          }
+        }
+
+      private:
+
+        GpuProfiler* profiler;
+        vk::raii::CommandBuffer* commandBuffer;
+        uint32_t index;
+
+    };
+
+    static Stats aggregate(std::vector<double> values) {
+      try {
+        Stats stats = {};
+        if (values.empty()) {
+          return stats;
+        }
+        std::sort(values.begin(), values.end());
+        size_t rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(values.size())));
+        stats.count = values.size();
+        stats.min = values.front();
+        stats.avg = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+        stats.p99 = values[std::max<size_t>(rank, 1) - 1];
+        return stats;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+    std::weak_ptr<vk::raii::Device> device;
+    std::weak_ptr<Tracer> tracer;
+    bool calibratedTimestamps = false;
+    bool calibrated = false;
+    float timestampPeriod = 1.0f;
+    uint64_t timestampMask = UINT64_MAX;
+    uint32_t frameCount = 0;
+    uint32_t maxScopes = 0;
+    size_t sampleCount = 0;
+    uint32_t currentFrame = 0;
+    std::vector<std::vector<std::string>> frameScopes;
+    std::vector<bool> framePending;
+    std::map<std::string, Samples> samples;
+    uint64_t droppedFrames = 0;
+    std::shared_ptr<vk::raii::QueryPool> value;
+
+    vk::raii::QueryPool& reference() {
+      try {
+        if (!value) {
+          throw std::runtime_error(CALL_INFO() + ": value is not initialized!");
+        }
+        return *value;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool calibrate() {
+      try {
+        std::shared_ptr<Tracer> lockedTracer = tracer.lock();
+        if (!lockedTracer || !calibratedTimestamps) {
+          return false;
+        }
+#if defined(_WIN32)
+        return false;
+#else
+        std::vector<vk::TimeDomainEXT> timeDomains = physicalDevice.lock()->getCalibrateableTimeDomainsEXT();
+        if (
+            std::find(timeDomains.begin(), timeDomains.end(), vk::TimeDomainEXT::eDevice) == timeDomains.end()
+            || std::find(timeDomains.begin(), timeDomains.end(), vk::TimeDomainEXT::eClockMonotonic) == timeDomains.end()
+        ) {
+          return false;
+        }
+        std::vector<vk::CalibratedTimestampInfoEXT> timestampInfos = {
+            vk::CalibratedTimestampInfoEXT().setTimeDomain(vk::TimeDomainEXT::eDevice),
+            vk::CalibratedTimestampInfoEXT().setTimeDomain(vk::TimeDomainEXT::eClockMonotonic)
+        };
+        std::pair<std::vector<uint64_t>, uint64_t> timestamps = device.lock()->getCalibratedTimestampsEXT(timestampInfos);
+        std::chrono::steady_clock::time_point cpuTime = std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(timestamps.first[1]))
+        );
+        lockedTracer->calibrate(toNanoseconds(timestamps.first[0]), cpuTime);
+        calibrated = true;
+        return true;
+#endif
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void calibrate(vk::raii::Queue& queue, vk::raii::CommandBuffer& commandBuffer) {
+      try {
+        if (calibrate()) {
+          return;
+        }
+        std::shared_ptr<Tracer> lockedTracer = tracer.lock();
+        if (!lockedTracer) {
+          return;
+        }
+        commandBuffer.reset();
+        commandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+        commandBuffer.resetQueryPool(*reference(), calibrationQuery(), 1);
+        commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, *reference(), calibrationQuery());
+        commandBuffer.end();
+
+        std::chrono::steady_clock::time_point submitTime = std::chrono::steady_clock::now();
+        queue.submit({vk::SubmitInfo().setCommandBuffers(*commandBuffer)});
+        queue.waitIdle();
+        std::chrono::steady_clock::time_point waitTime = std::chrono::steady_clock::now();
+
+        std::pair<vk::Result, uint64_t> result = reference().getResult<uint64_t>(
+            calibrationQuery(),
+            1,
+            sizeof(uint64_t),
+            vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait
+        );
+        if (vk::Result::eSuccess != result.first) {
+          throw std::runtime_error(CALL_INFO() + ": failed to read calibration timestamp!");
+        }
+        lockedTracer->calibrate(toNanoseconds(result.second), submitTime + (waitTime - submitTime) / 2);
+        calibrated = true;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void beginFrame(vk::raii::CommandBuffer& commandBuffer, const uint32_t& frameIndex) {
+      try {
+        currentFrame = frameIndex % frameCount;
+        collect(currentFrame);
+        frameScopes[currentFrame].clear();
+        commandBuffer.resetQueryPool(*reference(), firstQuery(currentFrame), maxScopes * 2);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t begin(
+        vk::raii::CommandBuffer& commandBuffer,
+        const std::string& name,
+        const vk::PipelineStageFlagBits& stage = vk::PipelineStageFlagBits::eTopOfPipe
+    ) {
+      try {
+        std::vector<std::string>& scopes = frameScopes[currentFrame];
+        if (scopes.size() >= maxScopes) {
+          throw std::runtime_error(CALL_INFO() + ": scope count exceeds maxScopes: " + std::to_string(maxScopes) + "!");
+        }
+        uint32_t index = static_cast<uint32_t>(scopes.size());
+        scopes.emplace_back(name);
+        framePending[currentFrame] = true;
+        commandBuffer.writeTimestamp(stage, *reference(), firstQuery(currentFrame) + index * 2);
+        return index;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void end(
+        vk::raii::CommandBuffer& commandBuffer,
+        const uint32_t& index,
+        const vk::PipelineStageFlagBits& stage = vk::PipelineStageFlagBits::eBottomOfPipe
+    ) {
+      try {
+        commandBuffer.writeTimestamp(stage, *reference(), firstQuery(currentFrame) + index * 2 + 1);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool collect(const uint32_t& frameIndex) {
+      try {
+        if (!framePending[frameIndex]) {
+          return false;
+        }
+        framePending[frameIndex] = false;
+        const std::vector<std::string>& scopes = frameScopes[frameIndex];
+        uint32_t queryCount = static_cast<uint32_t>(scopes.size()) * 2;
+        std::pair<vk::Result, std::vector<uint64_t>> results = reference().getResults<uint64_t>(
+            firstQuery(frameIndex),
+            queryCount,
+            queryCount * sizeof(uint64_t),
+            sizeof(uint64_t),
+            vk::QueryResultFlagBits::e64
+        );
+        if (vk::Result::eSuccess != results.first) {
+          droppedFrames++;
+          return false;
+        }
+#if defined(EXQUDENS_VULKAN_TRACE)
+        std::shared_ptr<Tracer> lockedTracer = calibrated ? tracer.lock() : nullptr;
+#endif
+        for (size_t i = 0; i < scopes.size(); i++) {
+          uint64_t ticks = (results.second[i * 2 + 1] - results.second[i * 2]) & timestampMask;
+          addSample(scopes[i], static_cast<double>(ticks) * timestampPeriod / 1000000.0);
+#if defined(EXQUDENS_VULKAN_TRACE)
+          if (lockedTracer) {
+            int64_t begin = toNanoseconds(results.second[i * 2]);
+            lockedTracer->recordGpu(scopes[i], begin, begin + static_cast<int64_t>(static_cast<double>(ticks) * timestampPeriod));
+          }
+#endif
+        }
+        return true;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void addSample(const std::string& name, const double& milliseconds) {
+      try {
+        Samples& entry = samples[name];
+        if (entry.values.size() < sampleCount) {
+          entry.values.emplace_back(milliseconds);
+        } else {
+          entry.values[entry.next] = milliseconds;
+        }
+        entry.next = (entry.next + 1) % sampleCount;
+        entry.count++;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    Stats stats(const std::string& name) {
+      try {
+        auto it = samples.find(name);
+        if (it == samples.end()) {
+          return {};
+        }
+        return aggregate(it->second.values);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::map<std::string, Stats> stats() {
+      try {
+        std::map<std::string, Stats> result;
+        for (const auto& [name, entry] : samples) {
+          result[name] = aggregate(entry.values);
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      uint32_t firstQuery(const uint32_t& frameIndex) {
+        return frameIndex * maxScopes * 2;
+      }
+
+      uint32_t calibrationQuery() {
+        return frameCount * maxScopes * 2;
+      }
+
+      int64_t toNanoseconds(const uint64_t& timestamp) {
+        return static_cast<int64_t>(static_cast<double>(timestamp & timestampMask) * timestampPeriod);
+      }
+
+  };
+
+  class GpuProfiler::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::weak_ptr<Tracer> tracer;
+      std::optional<bool> calibratedTimestamps;
+      std::optional<uint32_t> queueFamilyIndex;
+      std::optional<uint32_t> frameCount;
+      std::optional<uint32_t> maxScopes;
+      std::optional<size_t> sampleCount;
+
+    public:
+
+      GpuProfiler::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setTracer(const std::weak_ptr<Tracer>& val) {
+        tracer = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setCalibratedTimestamps(const bool& val) {
+        calibratedTimestamps = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setQueueFamilyIndex(const uint32_t& val) {
+        queueFamilyIndex = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setFrameCount(const uint32_t& val) {
+        frameCount = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setMaxScopes(const uint32_t& val) {
+        maxScopes = val;
+        return *this;
+      }
+
+      GpuProfiler::Builder& setSampleCount(const size_t& val) {
+        sampleCount = val;
+        return *this;
+      }
+
+      GpuProfiler build() {
+        try {
+          GpuProfiler target = {};
+          target.physicalDevice = physicalDevice;
+          target.device = device;
+          target.tracer = tracer;
+          target.calibratedTimestamps = calibratedTimestamps.value_or(false);
+          target.timestampPeriod = physicalDevice.lock()->getProperties().limits.timestampPeriod;
+          if (queueFamilyIndex.has_value()) {
+            uint32_t validBits = physicalDevice.lock()->getQueueFamilyProperties().at(queueFamilyIndex.value()).timestampValidBits;
+            if (validBits == 0) {
+              throw std::runtime_error(CALL_INFO() + ": queue family: " + std::to_string(queueFamilyIndex.value()) + " does not support timestamps!");
+            }
+            target.timestampMask = validBits >= 64 ? UINT64_MAX : (uint64_t(1) << validBits) - 1;
+          }
+          target.frameCount = frameCount.value_or(2);
+          target.maxScopes = maxScopes.value_or(32);
+          target.sampleCount = std::max<size_t>(sampleCount.value_or(256), 1);
+          target.frameScopes.resize(target.frameCount);
+          target.framePending.resize(target.frameCount, false);
+          target.value = std::make_shared<vk::raii::QueryPool>(
+              *device.lock(),
+              vk::QueryPoolCreateInfo()
+                  .setQueryType(vk::QueryType::eTimestamp)
+                  .setQueryCount(target.frameCount * target.maxScopes * 2 + 1)
+          );
+          target.calibrate();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  GpuProfiler::Builder GpuProfiler::builder() {
+    return {};
+  }
+
+}
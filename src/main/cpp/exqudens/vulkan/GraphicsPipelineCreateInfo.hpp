@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <optional>
+#include <vector>
+#include <algorithm>
 
 #include <vulkan/vulkan_raii.hpp>
 
@@ -13,6 +15,60 @@ namespace exqudens::vulkan {
 
   struct GraphicsPipelineCreateInfo: vk::GraphicsPipelineCreateInfo {
 
+    inline static const std::vector<vk::DynamicState> EXTENDED_DYNAMIC_STATES = {
+        vk::DynamicState::eCullModeEXT,
+        vk::DynamicState::eFrontFaceEXT,
+        vk::DynamicState::ePrimitiveTopologyEXT,
+        vk::DynamicState::eDepthTestEnableEXT,
+        vk::DynamicState::eDepthWriteEnableEXT,
+        vk::DynamicState::eDepthCompareOpEXT,
+        vk::DynamicState::eDepthBoundsTestEnableEXT,
+        vk::DynamicState::eStencilTestEnableEXT,
+        vk::DynamicState::eStencilOpEXT
+    };
+
+    GraphicsPipelineCreateInfo() = default;
+
+    GraphicsPipelineCreateInfo(const GraphicsPipelineCreateInfo& other):
+        vk::GraphicsPipelineCreateInfo(other),
+        stages(other.stages),
+        vertexInputState(other.vertexInputState),
+        inputAssemblyState(other.inputAssemblyState),
+        tessellationState(other.tessellationState),
+        viewportState(other.viewportState),
+        rasterizationState(other.rasterizationState),
+        multisampleState(other.multisampleState),
+        depthStencilState(other.depthStencilState),
+        colorBlendState(other.colorBlendState),
+        dynamicState(other.dynamicState),
+        dynamicStates(other.dynamicStates),
+        renderingCreateInfo(other.renderingCreateInfo),
+        colorAttachmentFormats(other.colorAttachmentFormats)
+    {
+      relink();
+    }
+
+    GraphicsPipelineCreateInfo& operator=(const GraphicsPipelineCreateInfo& other) {
+      if (this != &other) {
+        vk::GraphicsPipelineCreateInfo::operator=(other);
+        stages = other.stages;
+        vertexInputState = other.vertexInputState;
+        inputAssemblyState = other.inputAssemblyState;
+        tessellationState = other.tessellationState;
+        viewportState = other.viewportState;
+        rasterizationState = other.rasterizationState;
+        multisampleState = other.multisampleState;
+        depthStencilState = other.depthStencilState;
+        colorBlendState = other.colorBlendState;
+        dynamicState = other.dynamicState;
+        dynamicStates = other.dynamicStates;
+        renderingCreateInfo = other.renderingCreateInfo;
+        colorAttachmentFormats = other.colorAttachmentFormats;
+        relink();
+      }
+      return *this;
+    }
+
     GraphicsPipelineCreateInfo& setFlags(const vk::PipelineCreateFlags& value) {
       vk::GraphicsPipelineCreateInfo::setFlags(value);
       return *this;
@@ -38,6 +94,7 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    std::vector<vk::PipelineShaderStageCreateInfo> stages;
     std::optional<PipelineVertexInputStateCreateInfo> vertexInputState;
     std::optional<vk::PipelineInputAssemblyStateCreateInfo> inputAssemblyState;
     std::optional<vk::PipelineTessellationStateCreateInfo> tessellationState;
@@ -47,6 +104,15 @@ namespace exqudens::vulkan {
     std::optional<vk::PipelineDepthStencilStateCreateInfo> depthStencilState;
     std::optional<PipelineColorBlendStateCreateInfo> colorBlendState;
     std::optional<vk::PipelineDynamicStateCreateInfo> dynamicState;
+    std::vector<vk::DynamicState> dynamicStates;
+    std::optional<vk::PipelineRenderingCreateInfoKHR> renderingCreateInfo;
+    std::vector<vk::Format> colorAttachmentFormats;
+
+    GraphicsPipelineCreateInfo& setStages(const std::vector<vk::PipelineShaderStageCreateInfo>& value) {
+      stages = value;
+      vk::GraphicsPipelineCreateInfo::setStages(stages);
+      return *this;
+    }
 
     GraphicsPipelineCreateInfo& setVertexInputState(const PipelineVertexInputStateCreateInfo& value) {
       vertexInputState = value;
@@ -98,10 +164,140 @@ namespace exqudens::vulkan {
 
     GraphicsPipelineCreateInfo& setDynamicState(const vk::PipelineDynamicStateCreateInfo& value) {
       dynamicState = value;
+      dynamicStates.clear();
       vk::GraphicsPipelineCreateInfo::setPDynamicState(&dynamicState.value());
       return *this;
     }
 
+    GraphicsPipelineCreateInfo& addDynamicState(const vk::DynamicState& value) {
+      std::vector<vk::DynamicState> values = dynamicStates;
+      values.emplace_back(value);
+      return setDynamicStates(values);
+    }
+
+    GraphicsPipelineCreateInfo& setDynamicStates(const std::vector<vk::DynamicState>& value) {
+      dynamicStates.clear();
+      for (const vk::DynamicState& state : value) {
+        if (std::ranges::find(dynamicStates, state) == dynamicStates.end()) {
+          dynamicStates.emplace_back(state);
+        }
+      }
+      if (!dynamicState) {
+        dynamicState = vk::PipelineDynamicStateCreateInfo();
+      }
+      dynamicState.value().setDynamicStates(dynamicStates);
+      vk::GraphicsPipelineCreateInfo::setPDynamicState(&dynamicState.value());
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setDynamicViewport(const uint32_t& count = 1) {
+      addDynamicState(vk::DynamicState::eViewport);
+      addDynamicState(vk::DynamicState::eScissor);
+      if (!viewportState) {
+        setViewportState(PipelineViewportStateCreateInfo());
+      }
+      viewportState.value().setViewportCount(count);
+      viewportState.value().setScissorCount(count);
+      viewportState.value().viewports.clear();
+      viewportState.value().scissors.clear();
+      viewportState.value().setPViewports(nullptr);
+      viewportState.value().setPScissors(nullptr);
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setExtendedDynamicState() {
+      for (const vk::DynamicState& state : EXTENDED_DYNAMIC_STATES) {
+        addDynamicState(state);
+      }
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setRenderingCreateInfo(const vk::PipelineRenderingCreateInfoKHR& value) {
+      std::vector<vk::Format> formats;
+      if (value.colorAttachmentCount > 0 && value.pColorAttachmentFormats != nullptr) {
+        formats.assign(value.pColorAttachmentFormats, value.pColorAttachmentFormats + value.colorAttachmentCount);
+      }
+      const void* next = value.pNext != nullptr ? value.pNext : renderingCreateInfo ? renderingCreateInfo.value().pNext : pNext;
+      renderingCreateInfo = value;
+      renderingCreateInfo.value().setPNext(next);
+      colorAttachmentFormats = formats;
+      if (!colorAttachmentFormats.empty()) {
+        renderingCreateInfo.value().setColorAttachmentFormats(colorAttachmentFormats);
+      }
+      vk::GraphicsPipelineCreateInfo::setPNext(&renderingCreateInfo.value());
+      vk::GraphicsPipelineCreateInfo::setRenderPass(nullptr);
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setColorAttachmentFormats(const std::vector<vk::Format>& value) {
+      if (!renderingCreateInfo) {
+        setRenderingCreateInfo(vk::PipelineRenderingCreateInfoKHR());
+      }
+      colorAttachmentFormats = value;
+      renderingCreateInfo.value().setColorAttachmentFormats(colorAttachmentFormats);
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setDepthAttachmentFormat(const vk::Format& value) {
+      if (!renderingCreateInfo) {
+        setRenderingCreateInfo(vk::PipelineRenderingCreateInfoKHR());
+      }
+      renderingCreateInfo.value().setDepthAttachmentFormat(value);
+      return *this;
+    }
+
+    GraphicsPipelineCreateInfo& setStencilAttachmentFormat(const vk::Format& value) {
+      if (!renderingCreateInfo) {
+        setRenderingCreateInfo(vk::PipelineRenderingCreateInfoKHR());
+      }
+      renderingCreateInfo.value().setStencilAttachmentFormat(value);
+      return *this;
+    }
+
+    private:
+
+      void relink() {
+        if (!stages.empty()) {
+          pStages = stages.data();
+        }
+        if (vertexInputState) {
+          pVertexInputState = &vertexInputState.value();
+        }
+        if (inputAssemblyState) {
+          pInputAssemblyState = &inputAssemblyState.value();
+        }
+        if (tessellationState) {
+          pTessellationState = &tessellationState.value();
+        }
+        if (viewportState) {
+          pViewportState = &viewportState.value();
+        }
+        if (rasterizationState) {
+          pRasterizationState = &rasterizationState.value();
+        }
+        if (multisampleState) {
+          pMultisampleState = &multisampleState.value();
+        }
+        if (depthStencilState) {
+          pDepthStencilState = &depthStencilState.value();
+        }
+        if (colorBlendState) {
+          pColorBlendState = &colorBlendState.value();
+        }
+        if (dynamicState) {
+          if (!dynamicStates.empty()) {
+            dynamicState.value().pDynamicStates = dynamicStates.data();
+          }
+          pDynamicState = &dynamicState.value();
+        }
+        if (renderingCreateInfo) {
+          if (!colorAttachmentFormats.empty()) {
+            renderingCreateInfo.value().pColorAttachmentFormats = colorAttachmentFormats.data();
+          }
+          pNext = &renderingCreateInfo.value();
+        }
+      }
+
   };
 
 }
@@ -8,6 +8,9 @@
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+#include "exqudens/vulkan/MemoryAllocator.hpp"
 
 namespace exqudens::vulkan {
 
@@ -18,9 +21,11 @@ namespace exqudens::vulkan {
     static Builder builder();
 
     vk::ImageCreateInfo createInfo;
+    std::shared_ptr<MemoryAllocation> allocation;
     std::shared_ptr<vk::raii::Image> value;
     vk::MemoryPropertyFlags memoryCreateInfo;
     std::shared_ptr<vk::raii::DeviceMemory> memory;
+    vk::DeviceSize memoryOffset;
 
     vk::raii::Image& reference() {
       try {
@@ -57,6 +62,8 @@ namespace exqudens::vulkan {
           const uint32_t&,
           const vk::MemoryPropertyFlags&
       )> memoryTypeIndexFunction;
+      std::weak_ptr<MemoryTypeSelector> memoryTypeSelector;
+      std::weak_ptr<MemoryAllocator> memoryAllocator;
       std::optional<vk::ImageCreateInfo> createInfo;
       std::optional<vk::MemoryPropertyFlags> memoryCreateInfo;
 
@@ -83,6 +90,16 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Image::Builder& setMemoryTypeSelector(const std::weak_ptr<MemoryTypeSelector>& val) {
+        memoryTypeSelector = val;
+        return *this;
+      }
+
+      Image::Builder& setMemoryAllocator(const std::weak_ptr<MemoryAllocator>& val) {
+        memoryAllocator = val;
+        return *this;
+      }
+
       Image::Builder& setCreateInfo(const vk::ImageCreateInfo& val) {
         createInfo = val;
         return *this;
@@ -95,10 +112,6 @@ namespace exqudens::vulkan {
 
       Image build() {
         try {
-          if (!memoryTypeIndexFunction) {
-            memoryTypeIndexFunction = &Utility::memoryTypeIndex;
-          }
-
           Image target = {};
           target.createInfo = createInfo.value();
           target.value = std::make_shared<vk::raii::Image>(
@@ -107,18 +120,44 @@ namespace exqudens::vulkan {
           );
           target.memoryCreateInfo = memoryCreateInfo.value();
           vk::MemoryRequirements memoryRequirements = target.reference().getMemoryRequirements();
-          uint32_t memoryType = memoryTypeIndexFunction(
-              *physicalDevice.lock(),
-              memoryRequirements.memoryTypeBits,
-              target.memoryCreateInfo
-          );
-          target.memory = std::make_shared<vk::raii::DeviceMemory>(
-              *device.lock(),
-              vk::MemoryAllocateInfo()
-                  .setAllocationSize(memoryRequirements.size)
-                  .setMemoryTypeIndex(memoryType)
-          );
-          target.reference().bindMemory(*target.memoryReference(), 0);
+          if (!memoryAllocator.expired()) {
+            target.allocation = memoryAllocator.lock()->allocate(
+                memoryRequirements,
+                target.memoryCreateInfo,
+                target.createInfo.tiling == vk::ImageTiling::eLinear
+            );
+            target.memory = target.allocation->block->memory;
+            target.memoryOffset = target.allocation->offset;
+          } else {
+            uint32_t memoryType = 0;
+            if (memoryTypeIndexFunction) {
+              memoryType = memoryTypeIndexFunction(
+                  *physicalDevice.lock(),
+                  memoryRequirements.memoryTypeBits,
+                  target.memoryCreateInfo
+              );
+            } else {
+              std::shared_ptr<MemoryTypeSelector> selector = memoryTypeSelector.lock();
+              if (!selector) {
+                selector = MemoryTypeSelector::shared(physicalDevice);
+              }
+              memoryType = selector->memoryTypeIndex(
+                  memoryRequirements.memoryTypeBits,
+                  target.memoryCreateInfo,
+                  {},
+                  {},
+                  memoryRequirements.size
+              );
+            }
+            target.memory = std::make_shared<vk::raii::DeviceMemory>(
+                *device.lock(),
+                vk::MemoryAllocateInfo()
+                    .setAllocationSize(memoryRequirements.size)
+                    .setMemoryTypeIndex(memoryType)
+            );
+            target.memoryOffset = 0;
+          }
+          target.reference().bindMemory(*target.memoryReference(), target.memoryOffset);
           return target;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <span>
+#include <memory>
+#include <stdexcept>
+
+#if defined(_WINDOWS)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "exqudens/vulkan/Macros.hpp"
+
+namespace exqudens::vulkan {
+
+  struct MappedFile {
+
+    class Builder;
+
+    static Builder builder();
+
+    std::string path;
+    size_t size = 0;
+    std::shared_ptr<const char> value;
+
+    std::span<const char> bytes() {
+      try {
+        return std::span<const char>(value.get(), size);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::span<const uint32_t> words() {
+      try {
+        if (size % sizeof(uint32_t) != 0) {
+          throw std::runtime_error(CALL_INFO() + ": '" + path + "' size: " + std::to_string(size) + " is not a multiple of 4!");
+        }
+        return std::span<const uint32_t>(reinterpret_cast<const uint32_t*>(value.get()), size / sizeof(uint32_t));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void prefetch() {
+      try {
+        if (!value) {
+          return;
+        }
+#if !defined(_WINDOWS)
+        madvise(const_cast<char*>(value.get()), size, MADV_WILLNEED);
+#endif
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class MappedFile::Builder {
+
+    private:
+
+      std::optional<std::string> path;
+      std::optional<bool> prefetch;
+
+    public:
+
+      MappedFile::Builder& setPath(const std::string& val) {
+        path = val;
+        return *this;
+      }
+
+      MappedFile::Builder& setPrefetch(const bool& val) {
+        prefetch = val;
+        return *this;
+      }
+
+      MappedFile build() {
+        try {
+          MappedFile target = {};
+          target.path = path.value();
+#if defined(_WINDOWS)
+          HANDLE file = CreateFileA(target.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+          if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error(CALL_INFO() + ": failed to open file: '" + target.path + "'!");
+          }
+          LARGE_INTEGER fileSize = {};
+          if (!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            throw std::runtime_error(CALL_INFO() + ": failed to get file size: '" + target.path + "'!");
+          }
+          target.size = static_cast<size_t>(fileSize.QuadPart);
+          if (target.size > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const void* address = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (mapping != nullptr) {
+              CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            if (address == nullptr) {
+              throw std::runtime_error(CALL_INFO() + ": failed to map file: '" + target.path + "'!");
+            }
+            target.value = std::shared_ptr<const char>(static_cast<const char*>(address), [](const char* p) {
+              UnmapViewOfFile(p);
+            });
+          } else {
+            CloseHandle(file);
+          }
+#else
+          int descriptor = open(target.path.c_str(), O_RDONLY);
+          if (descriptor < 0) {
+            throw std::runtime_error(CALL_INFO() + ": failed to open file: '" + target.path + "'!");
+          }
+          struct stat status = {};
+          if (fstat(descriptor, &status) != 0) {
+            close(descriptor);
+            throw std::runtime_error(CALL_INFO() + ": failed to get file size: '" + target.path + "'!");
+          }
+          target.size = static_cast<size_t>(status.st_size);
+          if (target.size > 0) {
+            void* address = mmap(nullptr, target.size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            close(descriptor);
+            if (address == MAP_FAILED) {
+              throw std::runtime_error(CALL_INFO() + ": failed to map file: '" + target.path + "'!");
+            }
+            size_t length = target.size;
+            target.value = std::shared_ptr<const char>(static_cast<const char*>(address), [length](const char* p) {
+              munmap(const_cast<char*>(p), length);
+            });
+          } else {
+            close(descriptor);
+          }
+#endif
+          if (prefetch.value_or(false)) {
+            target.prefetch();
+          }
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  MappedFile::Builder MappedFile::builder() {
+    return {};
+  }
+
+}
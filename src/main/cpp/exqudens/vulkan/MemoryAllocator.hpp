@@ -0,0 +1,420 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+
+namespace exqudens::vulkan {
+
+  struct MemoryBlock {
+
+    struct Range {
+
+      vk::DeviceSize size;
+      bool linear;
+
+    };
+
+    static vk::DeviceSize alignUp(const vk::DeviceSize& value, const vk::DeviceSize& alignment) {
+      if (alignment <= 1) {
+        return value;
+      }
+      return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static bool onSamePage(
+        const vk::DeviceSize& lastByteOfPrevious,
+        const vk::DeviceSize& firstByteOfNext,
+        const vk::DeviceSize& pageSize
+    ) {
+      if (pageSize <= 1) {
+        return false;
+      }
+      return (lastByteOfPrevious / pageSize) == (firstByteOfNext / pageSize);
+    }
+
+    static std::optional<vk::DeviceSize> findOffset(
+        const std::map<vk::DeviceSize, Range>& ranges,
+        const vk::DeviceSize& blockSize,
+        const vk::DeviceSize& size,
+        const vk::DeviceSize& alignment,
+        const bool& linear,
+        const vk::DeviceSize& granularity
+    ) {
+      std::optional<std::pair<vk::DeviceSize, Range>> previous;
+      auto it = ranges.begin();
+      while (true) {
+        vk::DeviceSize gapBegin = previous ? previous.value().first + previous.value().second.size : 0;
+        vk::DeviceSize gapEnd = it != ranges.end() ? it->first : blockSize;
+
+        vk::DeviceSize offset = alignUp(gapBegin, alignment);
+        if (
+            previous
+            && previous.value().second.linear != linear
+            && onSamePage(gapBegin - 1, offset, granularity)
+        ) {
+          offset = alignUp(offset, granularity);
+        }
+        vk::DeviceSize end = offset + size;
+        bool fits = end <= gapEnd;
+        if (
+            fits
+            && it != ranges.end()
+            && it->second.linear != linear
+            && onSamePage(end - 1, it->first, granularity)
+        ) {
+          fits = false;
+        }
+        if (fits) {
+          return offset;
+        }
+
+        if (it == ranges.end()) {
+          return std::nullopt;
+        }
+        previous = *it;
+        it++;
+      }
+    }
+
+    uint32_t memoryTypeIndex = 0;
+    vk::DeviceSize size = 0;
+    bool dedicated = false;
+    std::shared_ptr<vk::raii::DeviceMemory> memory;
+    void* data = nullptr;
+    std::map<vk::DeviceSize, Range> ranges;
+    vk::DeviceSize usedSize = 0;
+    std::mutex mutex;
+
+    vk::raii::DeviceMemory& memoryReference() {
+      try {
+        if (!memory) {
+          throw std::runtime_error(CALL_INFO() + ": memory is not initialized!");
+        }
+        return *memory;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    ~MemoryBlock() {
+      if (data != nullptr && memory) {
+        memory->unmapMemory();
+      }
+    }
+
+  };
+
+  struct MemoryAllocation {
+
+    std::shared_ptr<MemoryBlock> block;
+    vk::DeviceSize offset = 0;
+    vk::DeviceSize size = 0;
+
+    vk::raii::DeviceMemory& memoryReference() {
+      try {
+        if (!block) {
+          throw std::runtime_error(CALL_INFO() + ": block is not initialized!");
+        }
+        return block->memoryReference();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void* data() {
+      if (!block || block->data == nullptr) {
+        return nullptr;
+      }
+      return static_cast<char*>(block->data) + offset;
+    }
+
+    ~MemoryAllocation() {
+      if (block) {
+        std::lock_guard<std::mutex> lock(block->mutex);
+        auto it = block->ranges.find(offset);
+        if (it != block->ranges.end()) {
+          block->usedSize -= it->second.size;
+          block->ranges.erase(it);
+        }
+      }
+    }
+
+  };
+
+  struct MemoryAllocatorStatistics {
+
+    size_t blockCount = 0;
+    size_t dedicatedBlockCount = 0;
+    size_t allocationCount = 0;
+    vk::DeviceSize blockBytes = 0;
+    vk::DeviceSize usedBytes = 0;
+    vk::DeviceSize freeBytes = 0;
+    vk::DeviceSize largestFreeRange = 0;
+    double fragmentation = 0.0;
+
+  };
+
+  struct MemoryAllocator {
+
+    class Builder;
+
+    static Builder builder();
+
+    std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+    std::weak_ptr<vk::raii::Device> device;
+    std::function<uint32_t(
+        vk::raii::PhysicalDevice&,
+        const uint32_t&,
+        const vk::MemoryPropertyFlags&
+    )> memoryTypeIndexFunction;
+    vk::DeviceSize blockSize = 0;
+    vk::DeviceSize bufferImageGranularity = 1;
+    vk::PhysicalDeviceMemoryProperties memoryProperties;
+    std::map<uint32_t, std::vector<std::shared_ptr<MemoryBlock>>> blocks;
+    std::vector<std::weak_ptr<MemoryBlock>> dedicatedBlocks;
+    std::shared_ptr<std::mutex> mutex;
+
+    std::shared_ptr<MemoryAllocation> allocate(
+        const vk::MemoryRequirements& requirements,
+        const vk::MemoryPropertyFlags& properties,
+        const bool& linear
+    ) {
+      try {
+        if (!mutex) {
+          throw std::runtime_error(CALL_INFO() + ": mutex is not initialized!");
+        }
+        std::lock_guard<std::mutex> lock(*mutex);
+
+        uint32_t memoryType = memoryTypeIndexFunction(
+            *physicalDevice.lock(),
+            requirements.memoryTypeBits,
+            properties
+        );
+
+        if (requirements.size > blockSize / 2) {
+          std::shared_ptr<MemoryBlock> block = createBlock(memoryType, requirements.size, true);
+          return place(block, 0, requirements.size, linear);
+        }
+
+        for (std::shared_ptr<MemoryBlock>& block : blocks[memoryType]) {
+          std::lock_guard<std::mutex> blockLock(block->mutex);
+          if (block->size - block->usedSize < requirements.size) {
+            continue;
+          }
+          std::optional<vk::DeviceSize> offset = MemoryBlock::findOffset(
+              block->ranges,
+              block->size,
+              requirements.size,
+              requirements.alignment,
+              linear,
+              bufferImageGranularity
+          );
+          if (offset) {
+            return placeLocked(block, offset.value(), requirements.size, linear);
+          }
+        }
+
+        std::shared_ptr<MemoryBlock> block = createBlock(memoryType, blockSize, false);
+        return place(block, 0, requirements.size, linear);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void trim() {
+      try {
+        if (!mutex) {
+          throw std::runtime_error(CALL_INFO() + ": mutex is not initialized!");
+        }
+        std::lock_guard<std::mutex> lock(*mutex);
+        for (auto& [memoryType, typeBlocks] : blocks) {
+          std::erase_if(typeBlocks, [](const std::shared_ptr<MemoryBlock>& block) {
+            std::lock_guard<std::mutex> blockLock(block->mutex);
+            return block->ranges.empty();
+          });
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    MemoryAllocatorStatistics statistics() {
+      try {
+        if (!mutex) {
+          throw std::runtime_error(CALL_INFO() + ": mutex is not initialized!");
+        }
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::erase_if(dedicatedBlocks, [](const std::weak_ptr<MemoryBlock>& block) {
+          return block.expired();
+        });
+        std::vector<std::shared_ptr<MemoryBlock>> allBlocks;
+        for (auto& [memoryType, typeBlocks] : blocks) {
+          allBlocks.insert(allBlocks.end(), typeBlocks.begin(), typeBlocks.end());
+        }
+        for (std::weak_ptr<MemoryBlock>& block : dedicatedBlocks) {
+          if (std::shared_ptr<MemoryBlock> locked = block.lock()) {
+            allBlocks.emplace_back(locked);
+          }
+        }
+        MemoryAllocatorStatistics result = {};
+        for (std::shared_ptr<MemoryBlock>& block : allBlocks) {
+          std::lock_guard<std::mutex> blockLock(block->mutex);
+          result.blockCount++;
+          if (block->dedicated) {
+            result.dedicatedBlockCount++;
+          }
+          result.allocationCount += block->ranges.size();
+          result.blockBytes += block->size;
+          result.usedBytes += block->usedSize;
+          vk::DeviceSize previousEnd = 0;
+          for (const auto& [offset, range] : block->ranges) {
+            result.largestFreeRange = std::max(result.largestFreeRange, offset - previousEnd);
+            previousEnd = offset + range.size;
+          }
+          result.largestFreeRange = std::max(result.largestFreeRange, block->size - previousEnd);
+        }
+        result.freeBytes = result.blockBytes - result.usedBytes;
+        if (result.freeBytes > 0) {
+          result.fragmentation = 1.0 - static_cast<double>(result.largestFreeRange) / static_cast<double>(result.freeBytes);
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      std::shared_ptr<MemoryBlock> createBlock(const uint32_t& memoryType, const vk::DeviceSize& size, const bool& dedicated) {
+        try {
+          std::shared_ptr<MemoryBlock> block = std::make_shared<MemoryBlock>();
+          block->memoryTypeIndex = memoryType;
+          block->size = size;
+          block->dedicated = dedicated;
+          block->memory = std::make_shared<vk::raii::DeviceMemory>(
+              *device.lock(),
+              vk::MemoryAllocateInfo()
+                  .setAllocationSize(size)
+                  .setMemoryTypeIndex(memoryType)
+          );
+          if (memoryProperties.memoryTypes[memoryType].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible) {
+            block->data = block->memory->mapMemory(0, VK_WHOLE_SIZE);
+          }
+          if (dedicated) {
+            dedicatedBlocks.emplace_back(block);
+          } else {
+            blocks[memoryType].emplace_back(block);
+          }
+          return block;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::shared_ptr<MemoryAllocation> place(
+          const std::shared_ptr<MemoryBlock>& block,
+          const vk::DeviceSize& offset,
+          const vk::DeviceSize& size,
+          const bool& linear
+      ) {
+        std::lock_guard<std::mutex> blockLock(block->mutex);
+        return placeLocked(block, offset, size, linear);
+      }
+
+      std::shared_ptr<MemoryAllocation> placeLocked(
+          const std::shared_ptr<MemoryBlock>& block,
+          const vk::DeviceSize& offset,
+          const vk::DeviceSize& size,
+          const bool& linear
+      ) {
+        block->ranges[offset] = MemoryBlock::Range {.size = size, .linear = linear};
+        block->usedSize += size;
+        std::shared_ptr<MemoryAllocation> allocation = std::make_shared<MemoryAllocation>();
+        allocation->block = block;
+        allocation->offset = offset;
+        allocation->size = size;
+        return allocation;
+      }
+
+  };
+
+  class MemoryAllocator::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::function<uint32_t(
+          vk::raii::PhysicalDevice&,
+          const uint32_t&,
+          const vk::MemoryPropertyFlags&
+      )> memoryTypeIndexFunction;
+      std::optional<vk::DeviceSize> blockSize;
+
+    public:
+
+      MemoryAllocator::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      MemoryAllocator::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      MemoryAllocator::Builder& setMemoryTypeIndexFunction(
+          const std::function<uint32_t(
+              vk::raii::PhysicalDevice&,
+              const uint32_t&,
+              const vk::MemoryPropertyFlags&
+          )>& val
+      ) {
+        memoryTypeIndexFunction = val;
+        return *this;
+      }
+
+      MemoryAllocator::Builder& setBlockSize(const vk::DeviceSize& val) {
+        blockSize = val;
+        return *this;
+      }
+
+      MemoryAllocator build() {
+        try {
+          MemoryAllocator target = {};
+          target.physicalDevice = physicalDevice;
+          target.device = device;
+          target.memoryTypeIndexFunction = memoryTypeIndexFunction;
+          if (!target.memoryTypeIndexFunction) {
+            target.memoryTypeIndexFunction = MemoryTypeSelector::shared(physicalDevice)->memoryTypeIndexFunction();
+          }
+          target.blockSize = blockSize.value_or(64 * 1024 * 1024);
+          target.bufferImageGranularity = physicalDevice.lock()->getProperties().limits.bufferImageGranularity;
+          target.memoryProperties = physicalDevice.lock()->getMemoryProperties();
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  MemoryAllocator::Builder MemoryAllocator::builder() {
+    return {};
+  }
+
+}
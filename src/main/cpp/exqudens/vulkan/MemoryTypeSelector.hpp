@@ -0,0 +1,235 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <map>
+#include <utility>
+#include <bit>
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+
+namespace exqudens::vulkan {
+
+  struct MemoryTypeSelector {
+
+    class Builder;
+
+    static Builder builder();
+
+    static std::shared_ptr<MemoryTypeSelector> shared(const std::weak_ptr<vk::raii::PhysicalDevice>& physicalDevice);
+
+    static std::optional<uint32_t> select(
+        const vk::PhysicalDeviceMemoryProperties& memoryProperties,
+        const std::vector<vk::DeviceSize>& heapBudgets,
+        const uint32_t& typeBits,
+        const vk::MemoryPropertyFlags& required,
+        const vk::MemoryPropertyFlags& preferred,
+        const vk::MemoryPropertyFlags& avoided,
+        const vk::DeviceSize& size
+    ) {
+      try {
+        std::optional<uint32_t> result = {};
+        int resultScore = 0;
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+          if (((typeBits >> i) & 1) == 0) {
+            continue;
+          }
+          vk::MemoryPropertyFlags flags = memoryProperties.memoryTypes[i].propertyFlags;
+          if ((flags & required) != required) {
+            continue;
+          }
+          uint32_t heapIndex = memoryProperties.memoryTypes[i].heapIndex;
+          if (heapIndex < heapBudgets.size() && heapBudgets[heapIndex] < size) {
+            continue;
+          }
+          int score = std::popcount(static_cast<uint32_t>(flags & preferred)) * 2 - std::popcount(static_cast<uint32_t>(flags & avoided)) * 3;
+          if (!result.has_value() || score > resultScore) {
+            result = i;
+            resultScore = score;
+          }
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+    bool memoryBudget = false;
+    vk::PhysicalDeviceMemoryProperties memoryProperties;
+    std::vector<vk::DeviceSize> heapBudgets;
+
+    void updateBudget() {
+      try {
+        heapBudgets.resize(memoryProperties.memoryHeapCount);
+        if (memoryBudget) {
+          vk::StructureChain<vk::PhysicalDeviceMemoryProperties2, vk::PhysicalDeviceMemoryBudgetPropertiesEXT> chain = physicalDevice.lock()->getMemoryProperties2<
+              vk::PhysicalDeviceMemoryProperties2,
+              vk::PhysicalDeviceMemoryBudgetPropertiesEXT
+          >();
+          const vk::PhysicalDeviceMemoryBudgetPropertiesEXT& budget = chain.get<vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+          for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++) {
+            heapBudgets[i] = budget.heapBudget[i] > budget.heapUsage[i] ? budget.heapBudget[i] - budget.heapUsage[i] : 0;
+          }
+        } else {
+          for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; i++) {
+            heapBudgets[i] = memoryProperties.memoryHeaps[i].size;
+          }
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t memoryTypeIndex(
+        const uint32_t& typeBits,
+        const vk::MemoryPropertyFlags& required,
+        const vk::MemoryPropertyFlags& preferred = {},
+        const vk::MemoryPropertyFlags& avoided = {},
+        const vk::DeviceSize& size = 0
+    ) {
+      try {
+        std::optional<uint32_t> result = select(memoryProperties, heapBudgets, typeBits, required, preferred, avoided, size);
+        if (!result.has_value()) {
+          result = select(memoryProperties, {}, typeBits, required, preferred, avoided, size);
+        }
+        if (!result.has_value()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to find memory type index!");
+        }
+        return result.value();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t uniformMemoryTypeIndex(const uint32_t& typeBits, const vk::DeviceSize& size = 0) {
+      try {
+        return memoryTypeIndex(
+            typeBits,
+            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+            vk::MemoryPropertyFlagBits::eDeviceLocal,
+            {},
+            size
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t readbackMemoryTypeIndex(const uint32_t& typeBits, const vk::DeviceSize& size = 0) {
+      try {
+        return memoryTypeIndex(
+            typeBits,
+            vk::MemoryPropertyFlagBits::eHostVisible,
+            vk::MemoryPropertyFlagBits::eHostCached | vk::MemoryPropertyFlagBits::eHostCoherent,
+            vk::MemoryPropertyFlagBits::eDeviceLocal,
+            size
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::function<uint32_t(
+        vk::raii::PhysicalDevice&,
+        const uint32_t&,
+        const vk::MemoryPropertyFlags&
+    )> memoryTypeIndexFunction(
+        const vk::MemoryPropertyFlags& preferred = {},
+        const vk::MemoryPropertyFlags& avoided = {}
+    ) {
+      try {
+        vk::PhysicalDeviceMemoryProperties tmpMemoryProperties = memoryProperties;
+        std::vector<vk::DeviceSize> tmpHeapBudgets = heapBudgets;
+        return [tmpMemoryProperties, tmpHeapBudgets, preferred, avoided](
+            vk::raii::PhysicalDevice&,
+            const uint32_t& typeBits,
+            const vk::MemoryPropertyFlags& required
+        ) -> uint32_t {
+          std::optional<uint32_t> result = MemoryTypeSelector::select(tmpMemoryProperties, tmpHeapBudgets, typeBits, required, preferred, avoided, 1);
+          if (!result.has_value()) {
+            result = MemoryTypeSelector::select(tmpMemoryProperties, {}, typeBits, required, preferred, avoided, 1);
+          }
+          if (!result.has_value()) {
+            throw std::runtime_error(CALL_INFO() + ": failed to find memory type index!");
+          }
+          return result.value();
+        };
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class MemoryTypeSelector::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::optional<bool> memoryBudget;
+
+    public:
+
+      MemoryTypeSelector::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      MemoryTypeSelector::Builder& setMemoryBudget(const bool& val) {
+        memoryBudget = val;
+        return *this;
+      }
+
+      MemoryTypeSelector build() {
+        try {
+          MemoryTypeSelector target = {};
+          target.physicalDevice = physicalDevice;
+          target.memoryBudget = memoryBudget.value_or(false);
+          target.memoryProperties = physicalDevice.lock()->getMemoryProperties();
+          target.updateBudget();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  MemoryTypeSelector::Builder MemoryTypeSelector::builder() {
+    return {};
+  }
+
+  std::shared_ptr<MemoryTypeSelector> MemoryTypeSelector::shared(const std::weak_ptr<vk::raii::PhysicalDevice>& physicalDevice) {
+    try {
+      static std::mutex mutex;
+      static std::map<const vk::raii::PhysicalDevice*, std::pair<std::weak_ptr<vk::raii::PhysicalDevice>, std::shared_ptr<MemoryTypeSelector>>> selectors;
+      std::shared_ptr<vk::raii::PhysicalDevice> sharedPhysicalDevice = physicalDevice.lock();
+      if (!sharedPhysicalDevice) {
+        throw std::runtime_error(CALL_INFO() + ": physicalDevice is expired!");
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      std::erase_if(selectors, [](const auto& o) { return o.second.first.expired(); });
+      auto& [owner, selector] = selectors[sharedPhysicalDevice.get()];
+      if (!selector) {
+        owner = physicalDevice;
+        selector = std::make_shared<MemoryTypeSelector>(
+            MemoryTypeSelector::builder()
+                .setPhysicalDevice(physicalDevice)
+            .build()
+        );
+      }
+      return selector;
+    } catch (...) {
+      std::throw_with_nested(std::runtime_error(CALL_INFO()));
+    }
+  }
+
+}
@@ -1,66 +1,100 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <array>
+#include <bit>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <memory>
 #include <functional>
+#include <algorithm>
 #include <ostream>
 #include <iostream>
 
 #include <vulkan/vulkan_raii.hpp>
 
+#include "exqudens/vulkan/Macros.hpp"
 #include "exqudens/vulkan/MessengerCreateInfo.hpp"
 
 namespace exqudens::vulkan {
 
   struct Messenger {
 
+    inline static const size_t MESSAGE_CAPACITY = 2048;
+    inline static const size_t DUPLICATE_BUCKET_COUNT = 256;
+
+    struct DuplicateBucket {
+
+      std::atomic<size_t> key;
+      std::atomic<uint32_t> count;
+
+    };
+
+    struct Slot {
+
+      std::atomic<size_t> sequence;
+      vk::DebugUtilsMessageSeverityFlagsEXT severity;
+      vk::DebugUtilsMessageTypeFlagsEXT type;
+      size_t size;
+      std::array<char, MESSAGE_CAPACITY> message;
+
+    };
+
     static VkBool32 callback(
         VkDebugUtilsMessageSeverityFlagBitsEXT cSeverity,
         VkDebugUtilsMessageTypeFlagsEXT cType,
         const VkDebugUtilsMessengerCallbackDataEXT* callbackData,
         void* data
     ) {
-      Messenger* messenger = nullptr;
+      Messenger* messenger = reinterpret_cast<Messenger*>(data);
       std::string formatted = "<UNDEFINED>";
       try {
+        if (messenger == nullptr) {
+          return VK_FALSE;
+        }
+
         auto severity = vk::DebugUtilsMessageSeverityFlagsEXT(cSeverity);
         auto type = vk::DebugUtilsMessageTypeFlagsEXT(cType);
-        std::string message(callbackData->pMessage);
-        formatted = vk::to_string(severity) + " " + vk::to_string(type) + ": " + message;
+        bool exception = messenger->exceptionSeverity.has_value() && severity >= messenger->exceptionSeverity.value();
+        bool out = messenger->outSeverity.has_value() && severity >= messenger->outSeverity.value();
 
-        if (data != nullptr) {
-          try {
-            messenger = reinterpret_cast<Messenger*>(data);
-          } catch (...) {
-          }
-          if (messenger != nullptr) {
-            if (messenger->toStringFunction) {
-              formatted = messenger->toStringFunction(severity, type, message);
-            }
-            if (
-                messenger->exceptionSeverity.has_value()
-                && severity >= messenger->exceptionSeverity.value()
-            ) {
-              throw std::runtime_error(formatted);
-            }
-            if (
-                messenger->outSeverity.has_value()
-                && severity >= messenger->outSeverity.value()
-            ) {
-              if (messenger->value != nullptr) {
-                *messenger->value << formatted << std::endl;
-                return VK_FALSE;
-              } else {
-                std::cout << formatted << std::endl;
-                return VK_FALSE;
-              }
-            }
+        if (!exception && !out) {
+          messenger->filteredCount.fetch_add(1, std::memory_order_relaxed);
+          return VK_FALSE;
+        }
+
+        if (!exception && messenger->isDuplicate(callbackData)) {
+          messenger->suppressedCount.fetch_add(1, std::memory_order_relaxed);
+          return VK_FALSE;
+        }
+
+        if (!exception && messenger->async) {
+          if (!messenger->push(severity, type, callbackData->pMessage)) {
+            messenger->droppedCount.fetch_add(1, std::memory_order_relaxed);
           }
+          return VK_FALSE;
+        }
+
+        formatted = messenger->format(severity, type, std::string(callbackData->pMessage));
+
+        if (exception) {
+          throw std::runtime_error(formatted);
         }
 
+        std::lock_guard<std::mutex> lock(messenger->valueMutex);
+        *messenger->value << formatted << '\n';
+        messenger->writtenCount.fetch_add(1, std::memory_order_relaxed);
         return VK_FALSE;
       } catch (const std::exception& e) {
         if (messenger != nullptr && messenger->value != nullptr) {
+          std::lock_guard<std::mutex> lock(messenger->valueMutex);
           *messenger->value << formatted << std::endl;
         } else {
           std::cout << formatted << std::endl;
@@ -68,6 +102,7 @@ namespace exqudens::vulkan {
         std::throw_with_nested(std::runtime_error(CALL_INFO() + ": " + e.what()));
       } catch (...) {
         if (messenger != nullptr && messenger->value != nullptr) {
+          std::lock_guard<std::mutex> lock(messenger->valueMutex);
           *messenger->value << formatted << std::endl;
         } else {
           std::cout << formatted << std::endl;
@@ -84,6 +119,22 @@ namespace exqudens::vulkan {
         std::string
     )> toStringFunction;
     std::ostream* value;
+    std::mutex valueMutex;
+    bool async = false;
+    uint32_t duplicateLimit = 0;
+    std::chrono::nanoseconds duplicateWindow = std::chrono::seconds(1);
+    std::array<DuplicateBucket, DUPLICATE_BUCKET_COUNT> duplicateBuckets = {};
+    std::atomic<int64_t> duplicateWindowBegin = 0;
+    size_t capacity = 0;
+    std::unique_ptr<Slot[]> slots;
+    alignas(64) std::atomic<size_t> enqueuePosition = 0;
+    alignas(64) std::atomic<size_t> dequeuePosition = 0;
+    std::atomic<bool> running = false;
+    std::thread writer;
+    std::atomic<uint64_t> filteredCount = 0;
+    std::atomic<uint64_t> suppressedCount = 0;
+    std::atomic<uint64_t> droppedCount = 0;
+    std::atomic<uint64_t> writtenCount = 0;
 
     Messenger(
         std::ostream& out,
@@ -92,10 +143,183 @@ namespace exqudens::vulkan {
         exceptionSeverity(createInfo.exceptionSeverity),
         outSeverity(createInfo.outSeverity),
         toStringFunction(createInfo.toStringFunction),
-        value(&out)
+        value(&out),
+        async(createInfo.async.value_or(false)),
+        duplicateLimit(createInfo.duplicateLimit.value_or(0)),
+        duplicateWindow(createInfo.duplicateWindow.value_or(std::chrono::seconds(1)))
     {
+      duplicateWindowBegin = now();
+      if (async) {
+        capacity = std::bit_ceil(std::max<size_t>(createInfo.queueCapacity.value_or(512), 2));
+        slots = std::make_unique<Slot[]>(capacity);
+        for (size_t i = 0; i < capacity; i++) {
+          slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        running = true;
+        writer = std::thread([this]() {
+          write();
+        });
+      }
+    }
+
+    Messenger(const Messenger&) = delete;
+
+    Messenger& operator=(const Messenger&) = delete;
+
+    ~Messenger() {
+      try {
+        stop();
+      } catch (...) {
+      }
+    }
+
+    std::string format(
+        const vk::DebugUtilsMessageSeverityFlagsEXT& severity,
+        const vk::DebugUtilsMessageTypeFlagsEXT& type,
+        const std::string& message
+    ) {
+      try {
+        if (toStringFunction) {
+          return toStringFunction(severity, type, message);
+        }
+        return vk::to_string(severity) + " " + vk::to_string(type) + ": " + message;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool isDuplicate(const VkDebugUtilsMessengerCallbackDataEXT* callbackData) {
+      if (duplicateLimit == 0) {
+        return false;
+      }
+      int64_t time = now();
+      int64_t windowBegin = duplicateWindowBegin.load(std::memory_order_relaxed);
+      if (time - windowBegin > duplicateWindow.count() && duplicateWindowBegin.compare_exchange_strong(windowBegin, time, std::memory_order_relaxed)) {
+        for (DuplicateBucket& bucket : duplicateBuckets) {
+          bucket.key.store(0, std::memory_order_relaxed);
+          bucket.count.store(0, std::memory_order_relaxed);
+        }
+      }
+      size_t key = callbackData->messageIdNumber != 0
+          ? static_cast<size_t>(static_cast<uint32_t>(callbackData->messageIdNumber))
+          : std::hash<std::string_view>()(std::string_view(callbackData->pMessage != nullptr ? callbackData->pMessage : ""));
+      key = std::max<size_t>(key, 1);
+      for (size_t i = 0; i < DUPLICATE_BUCKET_COUNT; i++) {
+        DuplicateBucket& bucket = duplicateBuckets[(key + i) % DUPLICATE_BUCKET_COUNT];
+        size_t bucketKey = bucket.key.load(std::memory_order_relaxed);
+        if (bucketKey == 0 && bucket.key.compare_exchange_strong(bucketKey, key, std::memory_order_relaxed)) {
+          bucketKey = key;
+        }
+        if (bucketKey == key) {
+          return bucket.count.fetch_add(1, std::memory_order_relaxed) + 1 > duplicateLimit;
+        }
+      }
+      return false;
+    }
+
+    bool push(
+        const vk::DebugUtilsMessageSeverityFlagsEXT& severity,
+        const vk::DebugUtilsMessageTypeFlagsEXT& type,
+        const char* message
+    ) {
+      size_t position = enqueuePosition.load(std::memory_order_relaxed);
+      Slot* slot = nullptr;
+      while (true) {
+        slot = &slots[position & (capacity - 1)];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0) {
+          if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        } else if (difference < 0) {
+          return false;
+        } else {
+          position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+      }
+      slot->severity = severity;
+      slot->type = type;
+      slot->size = message != nullptr ? std::min(std::strlen(message), MESSAGE_CAPACITY) : 0;
+      if (slot->size > 0) {
+        std::memcpy(slot->message.data(), message, slot->size);
+      }
+      slot->sequence.store(position + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(std::string& formatted) {
+      try {
+        size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        Slot& slot = slots[position & (capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+          return false;
+        }
+        std::string message(slot.message.data(), slot.size);
+        if (slot.size == MESSAGE_CAPACITY) {
+          message += "...";
+        }
+        vk::DebugUtilsMessageSeverityFlagsEXT severity = slot.severity;
+        vk::DebugUtilsMessageTypeFlagsEXT type = slot.type;
+        slot.sequence.store(position + capacity, std::memory_order_release);
+        dequeuePosition.store(position + 1, std::memory_order_relaxed);
+        formatted = format(severity, type, message);
+        return true;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
     }
 
+    void stop() {
+      try {
+        if (writer.joinable()) {
+          running = false;
+          writer.join();
+        }
+        uint64_t suppressed = suppressedCount.exchange(0);
+        uint64_t dropped = droppedCount.exchange(0);
+        std::lock_guard<std::mutex> lock(valueMutex);
+        if (suppressed > 0 || dropped > 0) {
+          *value << "messenger: suppressed: " << suppressed << " dropped: " << dropped << '\n';
+        }
+        value->flush();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      }
+
+      void write() {
+        std::string formatted;
+        while (true) {
+          bool stopping = !running.load();
+          bool written = false;
+          try {
+            std::lock_guard<std::mutex> lock(valueMutex);
+            while (pop(formatted)) {
+              *value << formatted << '\n';
+              writtenCount.fetch_add(1, std::memory_order_relaxed);
+              written = true;
+            }
+            if (written) {
+              value->flush();
+            }
+          } catch (...) {
+          }
+          if (stopping) {
+            break;
+          }
+          if (!written) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          }
+        }
+      }
+
   };
 
 }
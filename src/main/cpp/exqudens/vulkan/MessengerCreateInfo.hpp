@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <chrono>
 #include <optional>
 #include <functional>
 #include <ostream>
@@ -13,11 +16,16 @@ namespace exqudens::vulkan {
 
     std::optional<vk::DebugUtilsMessageSeverityFlagsEXT> exceptionSeverity;
     std::optional<vk::DebugUtilsMessageSeverityFlagsEXT> outSeverity;
+    // called on the messenger writer thread when async is set, so it must be thread-safe
     std::function<std::string(
         vk::DebugUtilsMessageSeverityFlagsEXT,
         vk::DebugUtilsMessageTypeFlagsEXT,
         std::string
     )> toStringFunction;
+    std::optional<bool> async;
+    std::optional<size_t> queueCapacity;
+    std::optional<uint32_t> duplicateLimit;
+    std::optional<std::chrono::milliseconds> duplicateWindow;
 
     MessengerCreateInfo& setExceptionSeverity(const vk::DebugUtilsMessageSeverityFlagsEXT& value) {
       exceptionSeverity = value;
@@ -40,6 +48,26 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    MessengerCreateInfo& setAsync(const bool& value) {
+      async = value;
+      return *this;
+    }
+
+    MessengerCreateInfo& setQueueCapacity(const size_t& value) {
+      queueCapacity = value;
+      return *this;
+    }
+
+    MessengerCreateInfo& setDuplicateLimit(const uint32_t& value) {
+      duplicateLimit = value;
+      return *this;
+    }
+
+    MessengerCreateInfo& setDuplicateWindow(const std::chrono::milliseconds& value) {
+      duplicateWindow = value;
+      return *this;
+    }
+
   };
 
 }
@@ -0,0 +1,415 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+#include "exqudens/vulkan/Image.hpp"
+#include "exqudens/vulkan/ImageView.hpp"
+#include "exqudens/vulkan/Buffer.hpp"
+#include "exqudens/vulkan/Fence.hpp"
+#include "exqudens/vulkan/CommandBuffer.hpp"
+
+namespace exqudens::vulkan {
+
+  struct OffscreenTarget {
+
+    class Builder;
+
+    static Builder builder();
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::weak_ptr<vk::raii::Queue> queue;
+    vk::ImageCreateInfo createInfo;
+    vk::ImageLayout layout;
+    std::vector<Image> images;
+    std::vector<ImageView> imageViews;
+    std::vector<Buffer> readbackBuffers;
+    std::vector<void*> readbackData;
+    std::vector<CommandBuffer> readbackCommandBuffers;
+    std::vector<Fence> readbackFences;
+    std::vector<bool> readbackPending;
+    std::optional<uint32_t> imageIndex;
+    std::optional<uint32_t> presentedIndex;
+    uint64_t presentedCount = 0;
+
+    std::pair<vk::Result, uint32_t> acquireNextImage(const uint64_t& timeout, const vk::Semaphore& semaphore) {
+      try {
+        uint32_t nextIndex = imageIndex.has_value() ? (imageIndex.value() + 1) % static_cast<uint32_t>(images.size()) : 0;
+
+        vk::Result result = device.lock()->waitForFences({*readbackFences[nextIndex].reference()}, true, timeout);
+        if (vk::Result::eSuccess != result) {
+          return std::make_pair(result, nextIndex);
+        }
+
+        std::vector<vk::Semaphore> signalSemaphores = {};
+        if (semaphore) {
+          signalSemaphores.emplace_back(semaphore);
+        }
+        queue.lock()->submit({vk::SubmitInfo().setSignalSemaphores(signalSemaphores)});
+
+        imageIndex = nextIndex;
+        return std::make_pair(vk::Result::eSuccess, nextIndex);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result present(const std::vector<vk::Semaphore>& waitSemaphores, const uint32_t& index) {
+      try {
+        if (index >= images.size()) {
+          throw std::runtime_error(CALL_INFO() + ": index: " + std::to_string(index) + " is out of range!");
+        }
+
+        std::vector<vk::PipelineStageFlags> waitDstStageMask = std::vector<vk::PipelineStageFlags>(
+            waitSemaphores.size(),
+            vk::PipelineStageFlagBits::eTransfer
+        );
+        std::vector<vk::CommandBuffer> commandBuffers = {*readbackCommandBuffers[index].reference()};
+
+        device.lock()->resetFences({*readbackFences[index].reference()});
+        queue.lock()->submit(
+            {
+                vk::SubmitInfo()
+                    .setWaitSemaphores(waitSemaphores)
+                    .setWaitDstStageMask(waitDstStageMask)
+                    .setCommandBuffers(commandBuffers)
+            },
+            *readbackFences[index].reference()
+        );
+        readbackPending[index] = true;
+        presentedIndex = index;
+        presentedCount++;
+        return vk::Result::eSuccess;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool isReadbackComplete(const uint32_t& index) {
+      try {
+        if (!readbackPending[index]) {
+          return false;
+        }
+        vk::Result result = device.lock()->waitForFences({*readbackFences[index].reference()}, true, 0);
+        return vk::Result::eSuccess == result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    const void* readback(const uint32_t& index) {
+      try {
+        if (!isReadbackComplete(index)) {
+          return nullptr;
+        }
+        device.lock()->invalidateMappedMemoryRanges({
+            vk::MappedMemoryRange()
+                .setMemory(*readbackBuffers[index].memoryReference())
+                .setOffset(readbackBuffers[index].memoryOffset)
+                .setSize(VK_WHOLE_SIZE)
+        });
+        return readbackData[index];
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::optional<uint32_t> latestReadbackIndex() {
+      try {
+        if (!presentedIndex.has_value()) {
+          return {};
+        }
+        uint32_t count = static_cast<uint32_t>(images.size());
+        for (uint32_t i = 0; i < count; i++) {
+          uint32_t index = (presentedIndex.value() + count - i) % count;
+          if (isReadbackComplete(index)) {
+            return index;
+          }
+        }
+        return {};
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::DeviceSize readbackSize() {
+      try {
+        return readbackBuffers.front().createInfo.size;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class OffscreenTarget::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::weak_ptr<vk::raii::Queue> queue;
+      std::optional<vk::CommandPool> commandPool;
+      std::optional<vk::Format> format;
+      std::optional<vk::Extent2D> extent;
+      std::optional<uint32_t> imageCount;
+      std::optional<vk::ImageUsageFlags> usage;
+      std::optional<vk::ImageLayout> layout;
+
+    public:
+
+      OffscreenTarget::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setQueue(const std::weak_ptr<vk::raii::Queue>& val) {
+        queue = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setCommandPool(const vk::CommandPool& val) {
+        commandPool = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setFormat(const vk::Format& val) {
+        format = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setExtent(const vk::Extent2D& val) {
+        extent = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setImageCount(const uint32_t& val) {
+        imageCount = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setUsage(const vk::ImageUsageFlags& val) {
+        usage = val;
+        return *this;
+      }
+
+      OffscreenTarget::Builder& setLayout(const vk::ImageLayout& val) {
+        layout = val;
+        return *this;
+      }
+
+      OffscreenTarget build() {
+        try {
+          OffscreenTarget target = {};
+          target.device = device;
+          target.queue = queue;
+          target.layout = layout.value_or(vk::ImageLayout::eTransferSrcOptimal);
+          target.createInfo = vk::ImageCreateInfo()
+              .setImageType(vk::ImageType::e2D)
+              .setFormat(format.value_or(vk::Format::eR8G8B8A8Unorm))
+              .setExtent(
+                  vk::Extent3D()
+                      .setWidth(extent.value().width)
+                      .setHeight(extent.value().height)
+                      .setDepth(1)
+              )
+              .setMipLevels(1)
+              .setArrayLayers(1)
+              .setSamples(vk::SampleCountFlagBits::e1)
+              .setTiling(vk::ImageTiling::eOptimal)
+              .setUsage(usage.value_or(vk::ImageUsageFlagBits::eColorAttachment) | vk::ImageUsageFlagBits::eTransferSrc)
+              .setSharingMode(vk::SharingMode::eExclusive)
+              .setInitialLayout(vk::ImageLayout::eUndefined);
+
+          uint32_t count = imageCount.value_or(2);
+          vk::DeviceSize pixelSize = Utility::formatSize(target.createInfo.format);
+          vk::DeviceSize size = pixelSize * target.createInfo.extent.width * target.createInfo.extent.height;
+
+          std::shared_ptr<MemoryTypeSelector> memoryTypeSelector = MemoryTypeSelector::shared(physicalDevice);
+
+          target.readbackCommandBuffers = CommandBuffer::builder()
+              .setDevice(device)
+              .setCreateInfo(
+                  vk::CommandBufferAllocateInfo()
+                      .setCommandPool(commandPool.value())
+                      .setLevel(vk::CommandBufferLevel::ePrimary)
+              )
+          .buildAll(count);
+
+          for (uint32_t i = 0; i < count; i++) {
+            Image image = Image::builder()
+                .setPhysicalDevice(physicalDevice)
+                .setDevice(device)
+                .setCreateInfo(target.createInfo)
+                .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+            .build();
+
+            ImageView imageView = ImageView::builder()
+                .setDevice(device)
+                .setCreateInfo(
+                    vk::ImageViewCreateInfo()
+                        .setImage(*image.reference())
+                        .setViewType(vk::ImageViewType::e2D)
+                        .setFormat(target.createInfo.format)
+                        .setSubresourceRange(
+                            vk::ImageSubresourceRange()
+                                .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                .setBaseMipLevel(0)
+                                .setLevelCount(1)
+                                .setBaseArrayLayer(0)
+                                .setLayerCount(1)
+                        )
+                )
+            .build();
+
+            Buffer buffer = Buffer::builder()
+                .setPhysicalDevice(physicalDevice)
+                .setDevice(device)
+                .setMemoryTypeIndexFunction(
+                    [memoryTypeSelector](
+                        vk::raii::PhysicalDevice&,
+                        const uint32_t& typeBits,
+                        const vk::MemoryPropertyFlags&
+                    ) -> uint32_t {
+                      return memoryTypeSelector->readbackMemoryTypeIndex(typeBits);
+                    }
+                )
+                .setCreateInfo(
+                    vk::BufferCreateInfo()
+                        .setSize(size)
+                        .setUsage(vk::BufferUsageFlagBits::eTransferDst)
+                        .setSharingMode(vk::SharingMode::eExclusive)
+                )
+                .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible)
+            .build();
+            void* data = buffer.mapMemory(0, size);
+
+            Fence fence = Fence::builder()
+                .setDevice(device)
+                .setCreateInfo(
+                    vk::FenceCreateInfo()
+                        .setFlags(vk::FenceCreateFlagBits::eSignaled)
+                )
+            .build();
+
+            vk::ImageSubresourceRange subresourceRange = vk::ImageSubresourceRange()
+                .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                .setBaseMipLevel(0)
+                .setLevelCount(1)
+                .setBaseArrayLayer(0)
+                .setLayerCount(1);
+
+            vk::raii::CommandBuffer& commandBuffer = target.readbackCommandBuffers[i].reference();
+            commandBuffer.begin({});
+            commandBuffer.pipelineBarrier(
+                vk::PipelineStageFlagBits::eAllCommands,
+                vk::PipelineStageFlagBits::eTransfer,
+                vk::DependencyFlags(0),
+                {},
+                {},
+                {
+                    vk::ImageMemoryBarrier()
+                        .setSrcAccessMask(vk::AccessFlagBits::eMemoryWrite)
+                        .setDstAccessMask(vk::AccessFlagBits::eTransferRead)
+                        .setOldLayout(target.layout)
+                        .setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+                        .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                        .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                        .setImage(*image.reference())
+                        .setSubresourceRange(subresourceRange)
+                }
+            );
+            commandBuffer.copyImageToBuffer(
+                *image.reference(),
+                vk::ImageLayout::eTransferSrcOptimal,
+                *buffer.reference(),
+                {
+                    vk::BufferImageCopy()
+                        .setBufferOffset(0)
+                        .setBufferRowLength(0)
+                        .setBufferImageHeight(0)
+                        .setImageSubresource(
+                            vk::ImageSubresourceLayers()
+                                .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                .setMipLevel(0)
+                                .setBaseArrayLayer(0)
+                                .setLayerCount(1)
+                        )
+                        .setImageOffset({0, 0, 0})
+                        .setImageExtent(target.createInfo.extent)
+                }
+            );
+            commandBuffer.pipelineBarrier(
+                vk::PipelineStageFlagBits::eTransfer,
+                vk::PipelineStageFlagBits::eHost,
+                vk::DependencyFlags(0),
+                {},
+                {
+                    vk::BufferMemoryBarrier()
+                        .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                        .setDstAccessMask(vk::AccessFlagBits::eHostRead)
+                        .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                        .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                        .setBuffer(*buffer.reference())
+                        .setOffset(0)
+                        .setSize(VK_WHOLE_SIZE)
+                },
+                {}
+            );
+            if (vk::ImageLayout::eTransferSrcOptimal != target.layout) {
+              commandBuffer.pipelineBarrier(
+                  vk::PipelineStageFlagBits::eTransfer,
+                  vk::PipelineStageFlagBits::eAllCommands,
+                  vk::DependencyFlags(0),
+                  {},
+                  {},
+                  {
+                      vk::ImageMemoryBarrier()
+                          .setSrcAccessMask(vk::AccessFlagBits::eTransferRead)
+                          .setDstAccessMask(vk::AccessFlags())
+                          .setOldLayout(vk::ImageLayout::eTransferSrcOptimal)
+                          .setNewLayout(target.layout)
+                          .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                          .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                          .setImage(*image.reference())
+                          .setSubresourceRange(subresourceRange)
+                  }
+              );
+            }
+            commandBuffer.end();
+
+            target.images.emplace_back(image);
+            target.imageViews.emplace_back(imageView);
+            target.readbackBuffers.emplace_back(buffer);
+            target.readbackData.emplace_back(data);
+            target.readbackFences.emplace_back(fence);
+            target.readbackPending.emplace_back(false);
+          }
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  OffscreenTarget::Builder OffscreenTarget::builder() {
+    return {};
+  }
+
+}
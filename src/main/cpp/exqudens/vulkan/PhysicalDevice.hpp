@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <optional>
 #include <vector>
 #include <memory>
+#include <algorithm>
 #include <stdexcept>
 
 #include <vulkan/vulkan_raii.hpp>
@@ -18,8 +20,26 @@ namespace exqudens::vulkan {
 
     static Builder builder();
 
+    static bool isSupported(const vk::PhysicalDeviceDescriptorIndexingFeatures& requested, const vk::PhysicalDeviceDescriptorIndexingFeatures& supported) {
+      try {
+        return isSupported(requested, supported, offsetof(vk::PhysicalDeviceDescriptorIndexingFeatures, descriptorBindingVariableDescriptorCount));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static bool isSupported(const vk::PhysicalDeviceDynamicRenderingFeaturesKHR& requested, const vk::PhysicalDeviceDynamicRenderingFeaturesKHR& supported) {
+      try {
+        return isSupported(requested, supported, offsetof(vk::PhysicalDeviceDynamicRenderingFeaturesKHR, dynamicRendering));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
     std::vector<const char*> enabledExtensionNames;
     vk::PhysicalDeviceFeatures features;
+    std::optional<vk::PhysicalDeviceDescriptorIndexingFeatures> descriptorIndexingFeatures;
+    std::optional<vk::PhysicalDeviceDynamicRenderingFeaturesKHR> dynamicRenderingFeatures;
     std::vector<vk::QueueFlagBits> queueTypes;
     std::vector<float> queuePriorities;
     std::vector<vk::DeviceQueueCreateInfo> computeQueueCreateInfos;
@@ -40,6 +60,37 @@ namespace exqudens::vulkan {
       }
     }
 
+    void* featuresChain() {
+      try {
+        void* result = nullptr;
+        if (dynamicRenderingFeatures) {
+          dynamicRenderingFeatures.value().setPNext(result);
+          result = &dynamicRenderingFeatures.value();
+        }
+        if (descriptorIndexingFeatures) {
+          descriptorIndexingFeatures.value().setPNext(result);
+          result = &descriptorIndexingFeatures.value();
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      template<typename T>
+      static bool isSupported(const T& requested, const T& supported, const size_t& lastOffset) {
+        const char* requestedBytes = reinterpret_cast<const char*>(&requested);
+        const char* supportedBytes = reinterpret_cast<const char*>(&supported);
+        for (size_t offset = offsetof(VkBaseOutStructure, pNext) + sizeof(void*); offset <= lastOffset; offset += sizeof(VkBool32)) {
+          if (*reinterpret_cast<const VkBool32*>(requestedBytes + offset) && !*reinterpret_cast<const VkBool32*>(supportedBytes + offset)) {
+            return false;
+          }
+        }
+        return true;
+      }
+
   };
 
   class PhysicalDevice::Builder {
@@ -49,6 +100,8 @@ namespace exqudens::vulkan {
       std::weak_ptr<vk::raii::Instance> instance;
       std::vector<const char*> enabledExtensionNames;
       std::optional<vk::PhysicalDeviceFeatures> features;
+      std::optional<vk::PhysicalDeviceDescriptorIndexingFeatures> descriptorIndexingFeatures;
+      std::optional<vk::PhysicalDeviceDynamicRenderingFeaturesKHR> dynamicRenderingFeatures;
       std::vector<vk::QueueFlagBits> queueTypes;
       std::optional<vk::SurfaceKHR> surface;
       std::vector<float> queuePriorities;
@@ -80,6 +133,18 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      // requires a Vulkan 1.1 instance or VK_KHR_get_physical_device_properties2, adds VK_EXT_descriptor_indexing to the enabled extensions
+      PhysicalDevice::Builder& setDescriptorIndexingFeatures(const vk::PhysicalDeviceDescriptorIndexingFeatures& val) {
+        descriptorIndexingFeatures = val;
+        return *this;
+      }
+
+      // requires a Vulkan 1.1 instance or VK_KHR_get_physical_device_properties2, adds VK_KHR_dynamic_rendering to the enabled extensions
+      PhysicalDevice::Builder& setDynamicRenderingFeatures(const vk::PhysicalDeviceDynamicRenderingFeaturesKHR& val) {
+        dynamicRenderingFeatures = val;
+        return *this;
+      }
+
       PhysicalDevice::Builder& addQueueType(const vk::QueueFlagBits& val) {
         queueTypes.emplace_back(val);
         return *this;
@@ -110,7 +175,18 @@ namespace exqudens::vulkan {
         try {
           PhysicalDevice target = {};
           target.enabledExtensionNames = enabledExtensionNames;
+          if (descriptorIndexingFeatures && std::ranges::none_of(target.enabledExtensionNames, [](const char* o) { return std::string(o) == VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME; })) {
+            target.enabledExtensionNames.emplace_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+          }
+          if (dynamicRenderingFeatures && std::ranges::none_of(target.enabledExtensionNames, [](const char* o) { return std::string(o) == VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME; })) {
+            target.enabledExtensionNames.emplace_back(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+          }
+          if ((descriptorIndexingFeatures || dynamicRenderingFeatures) && instance.lock()->getDispatcher()->vkGetPhysicalDeviceFeatures2 == nullptr) {
+            throw std::runtime_error(CALL_INFO() + ": feature queries require a Vulkan 1.1 instance or '" + VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME + "'!");
+          }
           target.features = features.value_or(vk::PhysicalDeviceFeatures());
+          target.descriptorIndexingFeatures = descriptorIndexingFeatures;
+          target.dynamicRenderingFeatures = dynamicRenderingFeatures;
           target.queueTypes = queueTypes;
           target.queuePriorities = queuePriorities;
           std::vector<vk::raii::PhysicalDevice> values = vk::raii::PhysicalDevices(
@@ -122,6 +198,7 @@ namespace exqudens::vulkan {
             bool deviceExtensionAdequate = true;
             bool swapChainAdequate = true;
             bool anisotropyAdequate = true;
+            bool featuresAdequate = true;
 
             std::vector<vk::DeviceQueueCreateInfo> tmpComputeQueueCreateInfos = {};
             std::vector<vk::DeviceQueueCreateInfo> tmpTransferQueueCreateInfos = {};
@@ -209,6 +286,18 @@ namespace exqudens::vulkan {
               continue;
             }
 
+            if (target.descriptorIndexingFeatures) {
+              auto chain = physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures>();
+              featuresAdequate = isSupported(target.descriptorIndexingFeatures.value(), chain.get<vk::PhysicalDeviceDescriptorIndexingFeatures>());
+            }
+            if (featuresAdequate && target.dynamicRenderingFeatures) {
+              auto chain = physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDynamicRenderingFeaturesKHR>();
+              featuresAdequate = isSupported(target.dynamicRenderingFeatures.value(), chain.get<vk::PhysicalDeviceDynamicRenderingFeaturesKHR>());
+            }
+            if (!featuresAdequate) {
+              continue;
+            }
+
             target.computeQueueCreateInfos = tmpComputeQueueCreateInfos;
             target.transferQueueCreateInfos = tmpTransferQueueCreateInfos;
             target.graphicsQueueCreateInfos = tmpGraphicsQueueCreateInfos;
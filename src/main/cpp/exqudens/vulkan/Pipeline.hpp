@@ -2,13 +2,21 @@
 
 #include <optional>
 #include <vector>
+#include <span>
 #include <map>
 #include <functional>
+#include <algorithm>
 #include <memory>
+#include <type_traits>
 #include <stdexcept>
 
 #include <vulkan/vulkan_raii.hpp>
 
+#include "exqudens/vulkan/MappedFile.hpp"
+#include "exqudens/vulkan/DescriptorSetLayout.hpp"
+#include "exqudens/vulkan/DescriptorSetLayoutCache.hpp"
+#include "exqudens/vulkan/ShaderReflection.hpp"
+#include "exqudens/vulkan/ShaderModuleCache.hpp"
 #include "exqudens/vulkan/GraphicsPipelineCreateInfo.hpp"
 
 namespace exqudens::vulkan {
@@ -19,6 +27,8 @@ namespace exqudens::vulkan {
 
     static Builder builder();
 
+    ShaderReflection reflection;
+    std::vector<DescriptorSetLayout> descriptorSetLayouts;
     std::vector<vk::DescriptorSetLayout> setLayouts;
     std::vector<vk::PushConstantRange> pushConstantRanges;
     vk::PipelineLayoutCreateInfo layoutCreateInfo;
@@ -66,6 +76,99 @@ namespace exqudens::vulkan {
       }
     }
 
+    void setDynamicViewport(vk::raii::CommandBuffer& commandBuffer, const vk::Extent2D& extent) {
+      try {
+        if (!graphicsCreateInfo) {
+          throw std::runtime_error(CALL_INFO() + ": graphicsCreateInfo is not initialized!");
+        }
+        std::span<const vk::DynamicState> dynamicStates;
+        const std::optional<vk::PipelineDynamicStateCreateInfo>& dynamicState = graphicsCreateInfo.value().dynamicState;
+        if (dynamicState && dynamicState.value().pDynamicStates != nullptr) {
+          dynamicStates = std::span<const vk::DynamicState>(dynamicState.value().pDynamicStates, dynamicState.value().dynamicStateCount);
+        }
+        if (std::ranges::find(dynamicStates, vk::DynamicState::eViewport) != dynamicStates.end()) {
+          commandBuffer.setViewport(
+              0,
+              {
+                  vk::Viewport()
+                      .setX(0.0)
+                      .setY(0.0)
+                      .setWidth(static_cast<float>(extent.width))
+                      .setHeight(static_cast<float>(extent.height))
+                      .setMinDepth(0.0)
+                      .setMaxDepth(1.0)
+              }
+          );
+        }
+        if (std::ranges::find(dynamicStates, vk::DynamicState::eScissor) != dynamicStates.end()) {
+          commandBuffer.setScissor(
+              0,
+              {
+                  vk::Rect2D()
+                      .setOffset({0, 0})
+                      .setExtent(extent)
+              }
+          );
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void dispatch(
+        vk::raii::CommandBuffer& commandBuffer,
+        const std::vector<vk::DescriptorSet>& descriptorSets,
+        const std::span<const uint8_t>& pushConstants,
+        const uint32_t& groupCountX,
+        const uint32_t& groupCountY = 1,
+        const uint32_t& groupCountZ = 1
+    ) {
+      try {
+        if (!computeCreateInfo) {
+          throw std::runtime_error(CALL_INFO() + ": computeCreateInfo is not initialized!");
+        }
+        commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute, *reference());
+        if (!descriptorSets.empty()) {
+          commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute, *layoutReference(), 0, descriptorSets, {});
+        }
+        if (!pushConstants.empty()) {
+          commandBuffer.pushConstants<uint8_t>(
+              *layoutReference(),
+              vk::ShaderStageFlagBits::eCompute,
+              0,
+              vk::ArrayProxy<const uint8_t>(static_cast<uint32_t>(pushConstants.size()), pushConstants.data())
+          );
+        }
+        commandBuffer.dispatch(groupCountX, groupCountY, groupCountZ);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    template<typename T>
+    requires (std::is_trivially_copyable_v<T> && !std::is_convertible_v<T, std::span<const uint8_t>>)
+    void dispatch(
+        vk::raii::CommandBuffer& commandBuffer,
+        const std::vector<vk::DescriptorSet>& descriptorSets,
+        const T& pushConstants,
+        const uint32_t& groupCountX,
+        const uint32_t& groupCountY = 1,
+        const uint32_t& groupCountZ = 1
+    ) {
+      try {
+        dispatch(
+            commandBuffer,
+            descriptorSets,
+            std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(&pushConstants), sizeof(T)),
+            groupCountX,
+            groupCountY,
+            groupCountZ
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Pipeline::Builder {
@@ -74,14 +177,19 @@ namespace exqudens::vulkan {
 
       std::weak_ptr<vk::raii::Device> device;
       std::function<std::vector<char>(const std::string&)> readFileFunction;
+      std::optional<bool> reflectLayouts;
+      std::weak_ptr<DescriptorSetLayoutCache> descriptorSetLayoutCache;
+      std::weak_ptr<ShaderModuleCache> shaderModuleCache;
       std::vector<vk::DescriptorSetLayout> setLayouts;
       std::vector<vk::PushConstantRange> pushConstantRanges;
       std::optional<vk::PipelineLayoutCreateInfo> layoutCreateInfo;
       std::optional<vk::PipelineCacheCreateInfo> cacheCreateInfo;
+      std::weak_ptr<vk::raii::PipelineCache> cache;
       std::optional<vk::ComputePipelineCreateInfo> computeCreateInfo;
       std::optional<GraphicsPipelineCreateInfo> graphicsCreateInfo;
       std::optional<vk::RayTracingPipelineCreateInfoNV> rayTracingCreateInfo;
       std::vector<std::string> paths;
+      std::vector<std::pair<vk::ShaderStageFlagBits, std::span<const uint32_t>>> codes;
 
     public:
 
@@ -95,6 +203,21 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Pipeline::Builder& setReflectLayouts(const bool& val) {
+        reflectLayouts = val;
+        return *this;
+      }
+
+      Pipeline::Builder& setDescriptorSetLayoutCache(const std::weak_ptr<DescriptorSetLayoutCache>& val) {
+        descriptorSetLayoutCache = val;
+        return *this;
+      }
+
+      Pipeline::Builder& setShaderModuleCache(const std::weak_ptr<ShaderModuleCache>& val) {
+        shaderModuleCache = val;
+        return *this;
+      }
+
       Pipeline::Builder& addSetLayout(const vk::DescriptorSetLayout& val) {
         setLayouts.emplace_back(val);
         return *this;
@@ -125,6 +248,11 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Pipeline::Builder& setCache(const std::weak_ptr<vk::raii::PipelineCache>& val) {
+        cache = val;
+        return *this;
+      }
+
       Pipeline::Builder& setComputeCreateInfo(const vk::ComputePipelineCreateInfo& val) {
         computeCreateInfo = val;
         return *this;
@@ -150,45 +278,79 @@ namespace exqudens::vulkan {
         return *this;
       }
 
-      Pipeline build() {
-        try {
-          if (!readFileFunction) {
-            readFileFunction = &Utility::readFile;
-          }
+      Pipeline::Builder& addCode(const vk::ShaderStageFlagBits& stage, const std::span<const uint32_t>& val) {
+        codes.emplace_back(stage, val);
+        return *this;
+      }
 
+      Pipeline::Builder& setCodes(const std::vector<std::pair<vk::ShaderStageFlagBits, std::span<const uint32_t>>>& val) {
+        codes = val;
+        return *this;
+      }
+
+      Pipeline prepare() {
+        try {
           Pipeline target = {};
-          target.setLayouts = setLayouts;
-          target.pushConstantRanges = pushConstantRanges;
-          target.layoutCreateInfo = layoutCreateInfo.value_or(vk::PipelineLayoutCreateInfo());
-          target.layoutCreateInfo.setSetLayouts(target.setLayouts);
-          target.layoutCreateInfo.setPushConstantRanges(target.pushConstantRanges);
-          target.layout = std::make_shared<vk::raii::PipelineLayout>(
-              *device.lock(),
-              target.layoutCreateInfo
-          );
           target.cacheCreateInfo = cacheCreateInfo.value_or(vk::PipelineCacheCreateInfo());
-          target.cache = std::make_shared<vk::raii::PipelineCache>(
-              *device.lock(),
-              target.cacheCreateInfo
-          );
+          if (!cache.expired()) {
+            target.cache = cache.lock();
+          } else {
+            target.cache = std::make_shared<vk::raii::PipelineCache>(
+                *device.lock(),
+                target.cacheCreateInfo
+            );
+          }
           target.computeCreateInfo = computeCreateInfo;
           target.graphicsCreateInfo = graphicsCreateInfo;
           target.rayTracingCreateInfo = rayTracingCreateInfo;
-          if (graphicsCreateInfo) {
-            std::vector<vk::PipelineShaderStageCreateInfo> stages;
+          std::vector<vk::PipelineShaderStageCreateInfo> stages;
+          std::vector<ShaderReflection> reflections;
+          if (graphicsCreateInfo || computeCreateInfo) {
             for (const std::string& path : paths) {
               if (!target.shaders.contains(path)) {
-                std::vector<char> bytes = readFileFunction(path);
-                if (bytes.empty()) {
-                  throw std::runtime_error(CALL_INFO() + ": '" + path + "' failed to create shader module bytes is empty!");
+                std::shared_ptr<ShaderModuleCache> moduleCache = shaderModuleCache.lock();
+                MappedFile file = {};
+                std::span<const uint32_t> code;
+                std::vector<char> bytes;
+                if (!readFileFunction) {
+                  file = MappedFile::builder()
+                      .setPath(path)
+                      .setPrefetch(true)
+                  .build();
+                  code = file.words();
+                  if (code.empty()) {
+                    throw std::runtime_error(CALL_INFO() + ": '" + path + "' failed to create shader module code is empty!");
+                  }
+                  if (moduleCache) {
+                    target.shaders[path] = moduleCache->get(code);
+                  } else {
+                    vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
+                        .setCodeSize(code.size_bytes())
+                        .setPCode(code.data());
+                    target.shaders[path] = std::make_pair(
+                        shaderCreateInfo,
+                        std::make_shared<vk::raii::ShaderModule>(*device.lock(), shaderCreateInfo)
+                    );
+                  }
+                } else if (moduleCache && !reflectLayouts.value_or(false)) {
+                  target.shaders[path] = moduleCache->get(path, readFileFunction);
+                } else {
+                  bytes = readFileFunction(path);
+                  if (bytes.empty()) {
+                    throw std::runtime_error(CALL_INFO() + ": '" + path + "' failed to create shader module bytes is empty!");
+                  }
+                  if (moduleCache) {
+                    target.shaders[path] = moduleCache->get(bytes);
+                  } else {
+                    vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
+                        .setCodeSize(bytes.size())
+                        .setPCode(reinterpret_cast<const uint32_t*>(bytes.data()));
+                    target.shaders[path] = std::make_pair(
+                        shaderCreateInfo,
+                        std::make_shared<vk::raii::ShaderModule>(*device.lock(), shaderCreateInfo)
+                    );
+                  }
                 }
-                vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
-                    .setCodeSize(bytes.size())
-                    .setPCode(reinterpret_cast<const uint32_t*>(bytes.data()));
-                target.shaders[path] = std::make_pair(
-                    shaderCreateInfo,
-                    std::make_shared<vk::raii::ShaderModule>(*device.lock(), shaderCreateInfo)
-                );
                 vk::PipelineShaderStageCreateInfo stage = vk::PipelineShaderStageCreateInfo();
                 stage.setPName("main");
                 stage.setModule(*(*target.shaders[path].second));
@@ -196,19 +358,117 @@ namespace exqudens::vulkan {
                   stage.setStage(vk::ShaderStageFlagBits::eVertex);
                 } else if (path.ends_with(".frag.spv")) {
                   stage.setStage(vk::ShaderStageFlagBits::eFragment);
+                } else if (path.ends_with(".comp.spv")) {
+                  stage.setStage(vk::ShaderStageFlagBits::eCompute);
                 } else {
                   throw std::invalid_argument(CALL_INFO() + ": '" + path + "' failed to create shader!");
                 }
                 stages.emplace_back(stage);
+                if (reflectLayouts.value_or(false)) {
+                  reflections.emplace_back(code.empty() ? ShaderReflection::reflect(bytes) : ShaderReflection::reflect(code));
+                }
+              }
+            }
+            for (const auto& [codeStage, code] : codes) {
+              std::string key = vk::to_string(codeStage);
+              if (!target.shaders.contains(key)) {
+                if (code.empty()) {
+                  throw std::runtime_error(CALL_INFO() + ": '" + key + "' failed to create shader module code is empty!");
+                }
+                std::shared_ptr<ShaderModuleCache> moduleCache = shaderModuleCache.lock();
+                if (moduleCache) {
+                  target.shaders[key] = moduleCache->get(code);
+                } else {
+                  vk::ShaderModuleCreateInfo shaderCreateInfo = vk::ShaderModuleCreateInfo()
+                      .setCodeSize(code.size_bytes())
+                      .setPCode(code.data());
+                  target.shaders[key] = std::make_pair(
+                      shaderCreateInfo,
+                      std::make_shared<vk::raii::ShaderModule>(*device.lock(), shaderCreateInfo)
+                  );
+                }
+                stages.emplace_back(
+                    vk::PipelineShaderStageCreateInfo()
+                        .setPName("main")
+                        .setStage(codeStage)
+                        .setModule(*(*target.shaders[key].second))
+                );
+                if (reflectLayouts.value_or(false)) {
+                  reflections.emplace_back(ShaderReflection::reflect(code));
+                }
+              }
+            }
+          }
+          if (graphicsCreateInfo && std::ranges::any_of(stages, [](const vk::PipelineShaderStageCreateInfo& o) { return o.stage == vk::ShaderStageFlagBits::eCompute; })) {
+            throw std::invalid_argument(CALL_INFO() + ": graphics pipeline does not accept a compute shader!");
+          }
+          target.setLayouts = setLayouts;
+          target.pushConstantRanges = pushConstantRanges;
+          if (reflectLayouts.value_or(false)) {
+            target.reflection = ShaderReflection::merge(reflections);
+            if (target.setLayouts.empty()) {
+              std::shared_ptr<DescriptorSetLayoutCache> layoutCache = descriptorSetLayoutCache.lock();
+              if (!layoutCache) {
+                layoutCache = std::make_shared<DescriptorSetLayoutCache>(
+                    DescriptorSetLayoutCache::builder()
+                        .setDevice(device)
+                    .build()
+                );
+              }
+              for (uint32_t set = 0; set < target.reflection.setCount(); set++) {
+                target.descriptorSetLayouts.emplace_back(layoutCache->get(target.reflection.setBindings(set)));
+                target.setLayouts.emplace_back(*target.descriptorSetLayouts.back().reference());
               }
             }
+            if (target.pushConstantRanges.empty()) {
+              target.pushConstantRanges = target.reflection.pushConstantRanges;
+            }
+            if (target.graphicsCreateInfo && !target.graphicsCreateInfo.value().vertexInputState && !target.reflection.vertexAttributes.empty()) {
+              target.graphicsCreateInfo.value().setVertexInputState(
+                  PipelineVertexInputStateCreateInfo()
+                      .setVertexBindingDescriptions({target.reflection.vertexBindingDescription()})
+                      .setVertexAttributeDescriptions(target.reflection.vertexAttributes)
+              );
+            }
+          }
+          target.layoutCreateInfo = layoutCreateInfo.value_or(vk::PipelineLayoutCreateInfo());
+          target.layoutCreateInfo.setSetLayouts(target.setLayouts);
+          target.layoutCreateInfo.setPushConstantRanges(target.pushConstantRanges);
+          target.layout = std::make_shared<vk::raii::PipelineLayout>(
+              *device.lock(),
+              target.layoutCreateInfo
+          );
+          if (graphicsCreateInfo) {
             target.graphicsCreateInfo.value().setStages(stages);
             target.graphicsCreateInfo.value().setLayout(*target.layoutReference());
+          } else if (computeCreateInfo) {
+            if (stages.size() != 1 || stages.front().stage != vk::ShaderStageFlagBits::eCompute) {
+              throw std::invalid_argument(CALL_INFO() + ": compute pipeline requires exactly one compute shader!");
+            }
+            target.computeCreateInfo.value().setStage(stages.front());
+            target.computeCreateInfo.value().setLayout(*target.layoutReference());
+          }
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      Pipeline build() {
+        try {
+          Pipeline target = prepare();
+          if (target.graphicsCreateInfo) {
             target.value = std::make_shared<vk::raii::Pipeline>(
                 *device.lock(),
                 target.cacheReference(),
                 target.graphicsCreateInfo.value()
             );
+          } else if (target.computeCreateInfo) {
+            target.value = std::make_shared<vk::raii::Pipeline>(
+                *device.lock(),
+                target.cacheReference(),
+                target.computeCreateInfo.value()
+            );
           }
           return target;
         } catch (...) {
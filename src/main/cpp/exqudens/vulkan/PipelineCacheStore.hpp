@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <optional>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Utility.hpp"
+
+namespace exqudens::vulkan {
+
+  struct PipelineCacheStore {
+
+    class Builder;
+
+    static Builder builder();
+
+    static bool isCompatible(const std::vector<char>& data, const vk::PhysicalDeviceProperties& properties) {
+      try {
+        const size_t headerSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+        if (data.size() < headerSize) {
+          return false;
+        }
+        uint32_t header[4] = {};
+        std::memcpy(header, data.data(), sizeof(header));
+        if (header[0] < headerSize || header[0] > data.size()) {
+          return false;
+        }
+        if (header[1] != static_cast<uint32_t>(vk::PipelineCacheHeaderVersion::eOne)) {
+          return false;
+        }
+        if (header[2] != properties.vendorID || header[3] != properties.deviceID) {
+          return false;
+        }
+        return std::memcmp(data.data() + sizeof(header), properties.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::string path;
+    std::vector<char> initialData;
+    vk::PipelineCacheCreateInfo createInfo;
+    std::shared_ptr<vk::raii::PipelineCache> value;
+
+    vk::raii::PipelineCache& reference() {
+      try {
+        if (!value) {
+          throw std::runtime_error(CALL_INFO() + ": value is not initialized!");
+        }
+        return *value;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void merge(const std::vector<vk::PipelineCache>& caches) {
+      try {
+        if (!caches.empty()) {
+          reference().merge(caches);
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static void write(const std::string& path, const std::vector<uint8_t>& data) {
+      try {
+        std::filesystem::path target = std::filesystem::path(path);
+        std::filesystem::path temporary = std::filesystem::path(path + ".tmp");
+        if (target.has_parent_path()) {
+          std::filesystem::create_directories(target.parent_path());
+        }
+
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to open file: '" + temporary.string() + "'!");
+        }
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        file.close();
+        if (file.fail()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to write file: '" + temporary.string() + "'!");
+        }
+
+        std::filesystem::rename(temporary, target);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void save() {
+      try {
+        if (path.empty()) {
+          throw std::runtime_error(CALL_INFO() + ": path is empty!");
+        }
+        write(path, reference().getData());
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class PipelineCacheStore::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::function<std::vector<char>(const std::string&)> readFileFunction;
+      std::optional<std::string> path;
+      std::optional<vk::PipelineCacheCreateInfo> createInfo;
+
+    public:
+
+      PipelineCacheStore::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      PipelineCacheStore::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      PipelineCacheStore::Builder& setReadFileFunction(const std::function<std::vector<char>(const std::string&)>& val) {
+        readFileFunction = val;
+        return *this;
+      }
+
+      PipelineCacheStore::Builder& setPath(const std::string& val) {
+        path = val;
+        return *this;
+      }
+
+      PipelineCacheStore::Builder& setCreateInfo(const vk::PipelineCacheCreateInfo& val) {
+        createInfo = val;
+        return *this;
+      }
+
+      PipelineCacheStore build() {
+        try {
+          if (!readFileFunction) {
+            readFileFunction = &Utility::readFile;
+          }
+
+          PipelineCacheStore target = {};
+          target.path = path.value();
+          if (std::filesystem::exists(target.path)) {
+            std::vector<char> data = readFileFunction(target.path);
+            if (PipelineCacheStore::isCompatible(data, physicalDevice.lock()->getProperties())) {
+              target.initialData = data;
+            }
+          }
+          target.createInfo = createInfo.value_or(vk::PipelineCacheCreateInfo());
+          target.createInfo.setInitialDataSize(target.initialData.size());
+          target.createInfo.setPInitialData(target.initialData.empty() ? nullptr : target.initialData.data());
+          target.value = std::make_shared<vk::raii::PipelineCache>(
+              *device.lock(),
+              target.createInfo
+          );
+          target.createInfo.setInitialDataSize(0);
+          target.createInfo.setPInitialData(nullptr);
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  PipelineCacheStore::Builder PipelineCacheStore::builder() {
+    return {};
+  }
+
+}
@@ -9,6 +9,24 @@ namespace exqudens::vulkan {
 
   struct PipelineColorBlendStateCreateInfo: vk::PipelineColorBlendStateCreateInfo {
 
+    PipelineColorBlendStateCreateInfo() = default;
+
+    PipelineColorBlendStateCreateInfo(const PipelineColorBlendStateCreateInfo& other):
+        vk::PipelineColorBlendStateCreateInfo(other),
+        attachments(other.attachments)
+    {
+      relink();
+    }
+
+    PipelineColorBlendStateCreateInfo& operator=(const PipelineColorBlendStateCreateInfo& other) {
+      if (this != &other) {
+        vk::PipelineColorBlendStateCreateInfo::operator=(other);
+        attachments = other.attachments;
+        relink();
+      }
+      return *this;
+    }
+
     PipelineColorBlendStateCreateInfo& setFlags(const vk::PipelineColorBlendStateCreateFlags& value) {
       vk::PipelineColorBlendStateCreateInfo::setFlags(value);
       return *this;
@@ -37,6 +55,14 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    private:
+
+      void relink() {
+        if (!attachments.empty()) {
+          pAttachments = attachments.data();
+        }
+      }
+
   };
 
 }
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <type_traits>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Pipeline.hpp"
+
+namespace exqudens::vulkan {
+
+  struct PipelineCompiler {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Pool {
+
+      std::vector<std::thread> threads;
+      std::deque<std::function<void()>> tasks;
+      std::mutex mutex;
+      std::condition_variable condition;
+      bool running = true;
+
+      explicit Pool(const uint32_t& threadCount) {
+        for (uint32_t i = 0; i < std::max<uint32_t>(threadCount, 1); i++) {
+          threads.emplace_back([this]() {
+            work();
+          });
+        }
+      }
+
+      Pool(const Pool&) = delete;
+
+      Pool& operator=(const Pool&) = delete;
+
+      ~Pool() {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          running = false;
+        }
+        condition.notify_all();
+        for (std::thread& thread : threads) {
+          if (thread.joinable()) {
+            thread.join();
+          }
+        }
+      }
+
+      template<typename F>
+      std::future<std::invoke_result_t<F>> submit(F&& function) {
+        try {
+          std::shared_ptr<std::packaged_task<std::invoke_result_t<F>()>> task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(
+              std::forward<F>(function)
+          );
+          std::future<std::invoke_result_t<F>> result = task->get_future();
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+              throw std::runtime_error(CALL_INFO() + ": pool is stopped!");
+            }
+            tasks.emplace_back([task]() {
+              (*task)();
+            });
+          }
+          condition.notify_one();
+          return result;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      private:
+
+        void work() {
+          while (true) {
+            std::function<void()> task;
+            {
+              std::unique_lock<std::mutex> lock(mutex);
+              condition.wait(lock, [this]() { return !running || !tasks.empty(); });
+              if (tasks.empty()) {
+                return;
+              }
+              task = std::move(tasks.front());
+              tasks.pop_front();
+            }
+            task();
+          }
+        }
+
+    };
+
+    std::weak_ptr<vk::raii::Device> device;
+    vk::PipelineCacheCreateInfo cacheCreateInfo;
+    std::shared_ptr<vk::raii::PipelineCache> cache;
+    std::shared_ptr<Pool> pool;
+
+    vk::raii::PipelineCache& cacheReference() {
+      try {
+        if (!cache) {
+          throw std::runtime_error(CALL_INFO() + ": cache is not initialized!");
+        }
+        return *cache;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::future<Pipeline> compile(Pipeline::Builder builder) {
+      try {
+        return pool->submit([builder, sharedCache = cache]() mutable {
+          builder.setCache(sharedCache);
+          return builder.build();
+        });
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::vector<std::future<Pipeline>> compileAll(const std::vector<Pipeline::Builder>& builders) {
+      try {
+        std::vector<std::future<Pipeline>> result;
+        result.reserve(builders.size());
+        for (const Pipeline::Builder& builder : builders) {
+          result.emplace_back(compile(builder));
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::future<std::vector<Pipeline>> compileBatch(std::vector<Pipeline::Builder> builders) {
+      try {
+        for (Pipeline::Builder& builder : builders) {
+          builder.setCache(cache);
+        }
+        return pool->submit([builders, sharedDevice = device.lock(), sharedCache = cache]() mutable {
+          std::vector<Pipeline> result;
+          result.reserve(builders.size());
+          for (Pipeline::Builder& builder : builders) {
+            result.emplace_back(builder.prepare());
+          }
+          std::vector<size_t> graphicsIndices;
+          std::vector<vk::GraphicsPipelineCreateInfo> graphicsCreateInfos;
+          std::vector<size_t> computeIndices;
+          std::vector<vk::ComputePipelineCreateInfo> computeCreateInfos;
+          for (size_t i = 0; i < result.size(); i++) {
+            if (result[i].graphicsCreateInfo) {
+              graphicsIndices.emplace_back(i);
+              graphicsCreateInfos.emplace_back(result[i].graphicsCreateInfo.value());
+            } else if (result[i].computeCreateInfo) {
+              computeIndices.emplace_back(i);
+              computeCreateInfos.emplace_back(result[i].computeCreateInfo.value());
+            }
+          }
+          if (!graphicsCreateInfos.empty()) {
+            vk::raii::Pipelines pipelines(*sharedDevice, *sharedCache, graphicsCreateInfos);
+            for (size_t i = 0; i < graphicsIndices.size(); i++) {
+              result[graphicsIndices[i]].value = std::make_shared<vk::raii::Pipeline>(std::move(pipelines[i]));
+            }
+          }
+          if (!computeCreateInfos.empty()) {
+            vk::raii::Pipelines pipelines(*sharedDevice, *sharedCache, computeCreateInfos);
+            for (size_t i = 0; i < computeIndices.size(); i++) {
+              result[computeIndices[i]].value = std::make_shared<vk::raii::Pipeline>(std::move(pipelines[i]));
+            }
+          }
+          return result;
+        });
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class PipelineCompiler::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+      std::optional<vk::PipelineCacheCreateInfo> cacheCreateInfo;
+      std::weak_ptr<vk::raii::PipelineCache> cache;
+      std::optional<uint32_t> threadCount;
+
+    public:
+
+      PipelineCompiler::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      PipelineCompiler::Builder& setCacheCreateInfo(const vk::PipelineCacheCreateInfo& val) {
+        cacheCreateInfo = val;
+        return *this;
+      }
+
+      PipelineCompiler::Builder& setCache(const std::weak_ptr<vk::raii::PipelineCache>& val) {
+        cache = val;
+        return *this;
+      }
+
+      PipelineCompiler::Builder& setThreadCount(const uint32_t& val) {
+        threadCount = val;
+        return *this;
+      }
+
+      PipelineCompiler build() {
+        try {
+          PipelineCompiler target = {};
+          target.device = device;
+          target.cacheCreateInfo = cacheCreateInfo.value_or(vk::PipelineCacheCreateInfo());
+          if (!cache.expired()) {
+            target.cache = cache.lock();
+          } else {
+            target.cache = std::make_shared<vk::raii::PipelineCache>(
+                *device.lock(),
+                target.cacheCreateInfo
+            );
+          }
+          target.pool = std::make_shared<Pool>(threadCount.value_or(std::max<uint32_t>(std::thread::hardware_concurrency(), 1)));
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  PipelineCompiler::Builder PipelineCompiler::builder() {
+    return {};
+  }
+
+}
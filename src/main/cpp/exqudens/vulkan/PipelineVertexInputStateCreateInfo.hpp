@@ -8,6 +8,26 @@ namespace exqudens::vulkan {
 
   struct PipelineVertexInputStateCreateInfo: vk::PipelineVertexInputStateCreateInfo {
 
+    PipelineVertexInputStateCreateInfo() = default;
+
+    PipelineVertexInputStateCreateInfo(const PipelineVertexInputStateCreateInfo& other):
+        vk::PipelineVertexInputStateCreateInfo(other),
+        vertexBindingDescriptions(other.vertexBindingDescriptions),
+        vertexAttributeDescriptions(other.vertexAttributeDescriptions)
+    {
+      relink();
+    }
+
+    PipelineVertexInputStateCreateInfo& operator=(const PipelineVertexInputStateCreateInfo& other) {
+      if (this != &other) {
+        vk::PipelineVertexInputStateCreateInfo::operator=(other);
+        vertexBindingDescriptions = other.vertexBindingDescriptions;
+        vertexAttributeDescriptions = other.vertexAttributeDescriptions;
+        relink();
+      }
+      return *this;
+    }
+
     std::vector<vk::VertexInputBindingDescription> vertexBindingDescriptions;
     std::vector<vk::VertexInputAttributeDescription> vertexAttributeDescriptions;
 
@@ -23,6 +43,17 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    private:
+
+      void relink() {
+        if (!vertexBindingDescriptions.empty()) {
+          pVertexBindingDescriptions = vertexBindingDescriptions.data();
+        }
+        if (!vertexAttributeDescriptions.empty()) {
+          pVertexAttributeDescriptions = vertexAttributeDescriptions.data();
+        }
+      }
+
   };
 
 }
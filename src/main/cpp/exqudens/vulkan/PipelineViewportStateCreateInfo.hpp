@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include <vulkan/vulkan_raii.hpp>
@@ -8,11 +9,41 @@ namespace exqudens::vulkan {
 
   struct PipelineViewportStateCreateInfo: vk::PipelineViewportStateCreateInfo {
 
+    PipelineViewportStateCreateInfo() = default;
+
+    PipelineViewportStateCreateInfo(const PipelineViewportStateCreateInfo& other):
+        vk::PipelineViewportStateCreateInfo(other),
+        viewports(other.viewports),
+        scissors(other.scissors)
+    {
+      relink();
+    }
+
+    PipelineViewportStateCreateInfo& operator=(const PipelineViewportStateCreateInfo& other) {
+      if (this != &other) {
+        vk::PipelineViewportStateCreateInfo::operator=(other);
+        viewports = other.viewports;
+        scissors = other.scissors;
+        relink();
+      }
+      return *this;
+    }
+
     PipelineViewportStateCreateInfo& setFlags(const vk::PipelineViewportStateCreateFlags& value) {
       vk::PipelineViewportStateCreateInfo::setFlags(value);
       return *this;
     }
 
+    PipelineViewportStateCreateInfo& setViewportCount(const uint32_t& value) {
+      vk::PipelineViewportStateCreateInfo::setViewportCount(value);
+      return *this;
+    }
+
+    PipelineViewportStateCreateInfo& setScissorCount(const uint32_t& value) {
+      vk::PipelineViewportStateCreateInfo::setScissorCount(value);
+      return *this;
+    }
+
     std::vector<vk::Viewport> viewports;
     std::vector<vk::Rect2D> scissors;
 
@@ -28,6 +59,17 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    private:
+
+      void relink() {
+        if (!viewports.empty()) {
+          pViewports = viewports.data();
+        }
+        if (!scissors.empty()) {
+          pScissors = scissors.data();
+        }
+      }
+
   };
 
 }
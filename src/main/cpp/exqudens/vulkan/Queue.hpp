@@ -1,12 +1,14 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 #include <memory>
 #include <stdexcept>
 
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
 
 namespace exqudens::vulkan {
 
@@ -18,6 +20,7 @@ namespace exqudens::vulkan {
 
     uint32_t familyIndex;
     uint32_t index;
+    std::weak_ptr<Tracer> tracer;
     std::shared_ptr<vk::raii::Queue> value;
 
     vk::raii::Queue& reference() {
@@ -31,6 +34,37 @@ namespace exqudens::vulkan {
       }
     }
 
+    void submit(const std::vector<vk::SubmitInfo>& submits, const vk::Fence& fence = {}) {
+      try {
+        TRACE_SCOPE(tracer, "queueSubmit");
+        reference().submit(submits, fence);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::Result present(const vk::PresentInfoKHR& presentInfo) {
+      try {
+        TRACE_SCOPE(tracer, "queuePresent");
+        try {
+          return reference().presentKHR(presentInfo);
+        } catch (const vk::OutOfDateKHRError&) {
+          return vk::Result::eErrorOutOfDateKHR;
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void waitIdle() {
+      try {
+        TRACE_SCOPE(tracer, "queueWaitIdle");
+        reference().waitIdle();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Queue::Builder {
@@ -40,6 +74,7 @@ namespace exqudens::vulkan {
       std::weak_ptr<vk::raii::Device> device;
       std::optional<uint32_t> familyIndex;
       std::optional<uint32_t> index;
+      std::weak_ptr<Tracer> tracer;
 
     public:
 
@@ -58,11 +93,17 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Queue::Builder& setTracer(const std::weak_ptr<Tracer>& val) {
+        tracer = val;
+        return *this;
+      }
+
       Queue build() {
         try {
           Queue target = {};
           target.familyIndex = familyIndex.value();
           target.index = index.value_or(0);
+          target.tracer = tracer;
           target.value = std::make_shared<vk::raii::Queue>(
               *device.lock(),
               target.familyIndex,
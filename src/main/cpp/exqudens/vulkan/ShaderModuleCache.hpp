@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <span>
+#include <map>
+#include <set>
+#include <mutex>
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+
+namespace exqudens::vulkan {
+
+  struct ShaderModuleCache {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct Entry {
+
+      std::vector<uint32_t> code;
+      vk::ShaderModuleCreateInfo createInfo;
+      std::shared_ptr<vk::raii::ShaderModule> value;
+
+    };
+
+    static uint64_t hash(const uint32_t* code, const size_t& wordCount) {
+      try {
+        uint64_t result = 0xCBF29CE484222325;
+        for (size_t i = 0; i < wordCount; i++) {
+          result ^= code[i];
+          result *= 0x100000001B3;
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::map<uint64_t, std::vector<std::shared_ptr<Entry>>> entries;
+    std::map<std::string, std::shared_ptr<Entry>> paths;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    std::pair<vk::ShaderModuleCreateInfo, std::shared_ptr<vk::raii::ShaderModule>> get(
+        const std::string& path,
+        const std::function<std::vector<char>(const std::string&)>& readFileFunction
+    ) {
+      try {
+        {
+          std::lock_guard<std::mutex> lock(*mutex);
+          auto it = paths.find(path);
+          if (it != paths.end()) {
+            hitCount++;
+            return share(it->second);
+          }
+        }
+        std::vector<char> bytes = readFileFunction(path);
+        if (bytes.empty()) {
+          throw std::runtime_error(CALL_INFO() + ": '" + path + "' failed to create shader module bytes is empty!");
+        }
+        std::vector<uint32_t> code = toCode(bytes);
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::shared_ptr<Entry> entry = find(code);
+        paths[path] = entry;
+        return share(entry);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::pair<vk::ShaderModuleCreateInfo, std::shared_ptr<vk::raii::ShaderModule>> get(const std::vector<char>& bytes) {
+      try {
+        return get(std::span<const uint32_t>(toCode(bytes)));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::pair<vk::ShaderModuleCreateInfo, std::shared_ptr<vk::raii::ShaderModule>> get(const std::span<const uint32_t>& code) {
+      try {
+        if (code.empty()) {
+          throw std::invalid_argument(CALL_INFO() + ": shader code is empty!");
+        }
+        std::lock_guard<std::mutex> lock(*mutex);
+        return share(find(code));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    size_t size() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        size_t result = 0;
+        for (const auto& [key, bucket] : entries) {
+          result += bucket.size();
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    size_t prune() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::map<const Entry*, long> pathCounts;
+        for (const auto& [path, entry] : paths) {
+          pathCounts[entry.get()]++;
+        }
+        std::set<const Entry*> unused;
+        for (const auto& [key, bucket] : entries) {
+          for (const std::shared_ptr<Entry>& entry : bucket) {
+            if (entry.use_count() == pathCounts[entry.get()] + 1) {
+              unused.insert(entry.get());
+            }
+          }
+        }
+        std::erase_if(paths, [&unused](const auto& o) { return unused.contains(o.second.get()); });
+        size_t result = 0;
+        for (auto& [key, bucket] : entries) {
+          result += std::erase_if(bucket, [&unused](const std::shared_ptr<Entry>& o) { return unused.contains(o.get()); });
+        }
+        std::erase_if(entries, [](const auto& o) { return o.second.empty(); });
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void clear() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        paths.clear();
+        entries.clear();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      static std::vector<uint32_t> toCode(const std::vector<char>& bytes) {
+        if (bytes.empty() || bytes.size() % sizeof(uint32_t) != 0) {
+          throw std::invalid_argument(CALL_INFO() + ": invalid shader code size: " + std::to_string(bytes.size()) + "!");
+        }
+        std::vector<uint32_t> code(bytes.size() / sizeof(uint32_t));
+        std::memcpy(code.data(), bytes.data(), bytes.size());
+        return code;
+      }
+
+      static std::pair<vk::ShaderModuleCreateInfo, std::shared_ptr<vk::raii::ShaderModule>> share(const std::shared_ptr<Entry>& entry) {
+        return std::make_pair(entry->createInfo, std::shared_ptr<vk::raii::ShaderModule>(entry, entry->value.get()));
+      }
+
+      std::shared_ptr<Entry> find(const std::span<const uint32_t>& code) {
+        std::vector<std::shared_ptr<Entry>>& bucket = entries[hash(code.data(), code.size())];
+        auto it = std::ranges::find_if(bucket, [&code](const std::shared_ptr<Entry>& o) { return std::ranges::equal(o->code, code); });
+        if (it != bucket.end()) {
+          hitCount++;
+          return *it;
+        }
+        missCount++;
+        std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+        entry->code.assign(code.begin(), code.end());
+        entry->createInfo = vk::ShaderModuleCreateInfo().setCode(entry->code);
+        entry->value = std::make_shared<vk::raii::ShaderModule>(*device.lock(), entry->createInfo);
+        bucket.emplace_back(entry);
+        return entry;
+      }
+
+  };
+
+  class ShaderModuleCache::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::Device> device;
+
+    public:
+
+      ShaderModuleCache::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      ShaderModuleCache build() {
+        try {
+          ShaderModuleCache target = {};
+          target.device = device;
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  ShaderModuleCache::Builder ShaderModuleCache::builder() {
+    return {};
+  }
+
+}
@@ -0,0 +1,432 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <optional>
+#include <vector>
+#include <span>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+
+namespace exqudens::vulkan {
+
+  struct ShaderReflection {
+
+    inline static const uint32_t MAGIC_NUMBER = 0x07230203;
+
+    inline static const uint32_t OP_ENTRY_POINT = 15;
+    inline static const uint32_t OP_TYPE_VOID = 19;
+    inline static const uint32_t OP_TYPE_BOOL = 20;
+    inline static const uint32_t OP_TYPE_INT = 21;
+    inline static const uint32_t OP_TYPE_FLOAT = 22;
+    inline static const uint32_t OP_TYPE_VECTOR = 23;
+    inline static const uint32_t OP_TYPE_MATRIX = 24;
+    inline static const uint32_t OP_TYPE_IMAGE = 25;
+    inline static const uint32_t OP_TYPE_SAMPLER = 26;
+    inline static const uint32_t OP_TYPE_SAMPLED_IMAGE = 27;
+    inline static const uint32_t OP_TYPE_ARRAY = 28;
+    inline static const uint32_t OP_TYPE_RUNTIME_ARRAY = 29;
+    inline static const uint32_t OP_TYPE_STRUCT = 30;
+    inline static const uint32_t OP_TYPE_POINTER = 32;
+    inline static const uint32_t OP_CONSTANT = 43;
+    inline static const uint32_t OP_VARIABLE = 59;
+    inline static const uint32_t OP_DECORATE = 71;
+    inline static const uint32_t OP_MEMBER_DECORATE = 72;
+    inline static const uint32_t OP_TYPE_ACCELERATION_STRUCTURE = 5341;
+
+    inline static const uint32_t DECORATION_BLOCK = 2;
+    inline static const uint32_t DECORATION_BUFFER_BLOCK = 3;
+    inline static const uint32_t DECORATION_ARRAY_STRIDE = 6;
+    inline static const uint32_t DECORATION_MATRIX_STRIDE = 7;
+    inline static const uint32_t DECORATION_BUILT_IN = 11;
+    inline static const uint32_t DECORATION_LOCATION = 30;
+    inline static const uint32_t DECORATION_BINDING = 33;
+    inline static const uint32_t DECORATION_DESCRIPTOR_SET = 34;
+    inline static const uint32_t DECORATION_OFFSET = 35;
+
+    inline static const uint32_t STORAGE_CLASS_UNIFORM_CONSTANT = 0;
+    inline static const uint32_t STORAGE_CLASS_INPUT = 1;
+    inline static const uint32_t STORAGE_CLASS_UNIFORM = 2;
+    inline static const uint32_t STORAGE_CLASS_PUSH_CONSTANT = 9;
+    inline static const uint32_t STORAGE_CLASS_STORAGE_BUFFER = 12;
+
+    static ShaderReflection reflect(const std::vector<char>& bytes) {
+      try {
+        if (bytes.size() % sizeof(uint32_t) != 0) {
+          throw std::invalid_argument(CALL_INFO() + ": spir-v size: " + std::to_string(bytes.size()) + " is not a multiple of 4!");
+        }
+        std::vector<uint32_t> code(bytes.size() / sizeof(uint32_t));
+        std::memcpy(code.data(), bytes.data(), bytes.size());
+        return reflect(std::span<const uint32_t>(code));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static ShaderReflection reflect(const std::span<const uint32_t>& code) {
+      try {
+        if (code.size() < 5 || code[0] != MAGIC_NUMBER) {
+          throw std::invalid_argument(CALL_INFO() + ": invalid spir-v header!");
+        }
+
+        ShaderReflection target = {};
+        Module module = {};
+        std::vector<std::vector<uint32_t>> variables;
+        size_t position = 5;
+        while (position < code.size()) {
+          uint32_t wordCount = code[position] >> 16;
+          uint32_t opcode = code[position] & 0xFFFF;
+          if (wordCount == 0 || position + wordCount > code.size()) {
+            throw std::invalid_argument(CALL_INFO() + ": invalid spir-v instruction at word: " + std::to_string(position) + "!");
+          }
+          std::vector<uint32_t> words(code.begin() + position, code.begin() + position + wordCount);
+          if (opcode == OP_ENTRY_POINT && wordCount >= 4 && !target.stages) {
+            target.stages = stage(words[1]);
+            target.entryPoint = literal(words, 3);
+          } else if (opcode == OP_DECORATE && wordCount >= 3) {
+            module.decorations[words[1]][words[2]] = wordCount >= 4 ? words[3] : 0;
+          } else if (opcode == OP_MEMBER_DECORATE && wordCount >= 4) {
+            module.memberDecorations[words[1]][words[2]][words[3]] = wordCount >= 5 ? words[4] : 0;
+          } else if (((opcode >= OP_TYPE_VOID && opcode <= OP_TYPE_POINTER) || opcode == OP_TYPE_ACCELERATION_STRUCTURE) && wordCount >= 2) {
+            module.types[words[1]] = words;
+          } else if (opcode == OP_CONSTANT && wordCount >= 4) {
+            module.types[words[2]] = words;
+          } else if (opcode == OP_VARIABLE && wordCount >= 4) {
+            variables.emplace_back(words);
+          }
+          position += wordCount;
+        }
+
+        std::map<uint32_t, vk::Format> attributes;
+        for (const std::vector<uint32_t>& variable : variables) {
+          uint32_t id = variable[2];
+          uint32_t storageClass = variable[3];
+          uint32_t typeId = module.types.at(variable[1]).at(3);
+          std::map<uint32_t, uint32_t>& decorations = module.decorations[id];
+
+          if (storageClass == STORAGE_CLASS_UNIFORM_CONSTANT || storageClass == STORAGE_CLASS_UNIFORM || storageClass == STORAGE_CLASS_STORAGE_BUFFER) {
+            if (!decorations.contains(DECORATION_BINDING)) {
+              continue;
+            }
+            uint32_t count = 1;
+            while (opcodeOf(module, typeId) == OP_TYPE_ARRAY || opcodeOf(module, typeId) == OP_TYPE_RUNTIME_ARRAY) {
+              if (opcodeOf(module, typeId) == OP_TYPE_ARRAY) {
+                count *= module.types.at(module.types.at(typeId).at(3)).at(3);
+              }
+              typeId = module.types.at(typeId).at(2);
+            }
+            std::optional<vk::DescriptorType> descriptorType = toDescriptorType(module, typeId, storageClass);
+            if (!descriptorType.has_value()) {
+              continue;
+            }
+            std::vector<vk::DescriptorSetLayoutBinding>& bindings = target.sets[decorations[DECORATION_DESCRIPTOR_SET]];
+            uint32_t binding = decorations.at(DECORATION_BINDING);
+            if (std::ranges::any_of(bindings, [&binding](const auto& o) { return o.binding == binding; })) {
+              continue;
+            }
+            bindings.emplace_back(
+                vk::DescriptorSetLayoutBinding()
+                    .setBinding(binding)
+                    .setDescriptorType(descriptorType.value())
+                    .setDescriptorCount(count)
+                    .setStageFlags(target.stages)
+            );
+          } else if (storageClass == STORAGE_CLASS_PUSH_CONSTANT) {
+            uint32_t offset = UINT32_MAX;
+            const std::vector<uint32_t>& type = module.types.at(typeId);
+            for (size_t i = 2; i < type.size(); i++) {
+              offset = std::min(offset, module.memberDecorations[typeId][static_cast<uint32_t>(i - 2)][DECORATION_OFFSET]);
+            }
+            uint32_t size = sizeOf(module, typeId);
+            if (offset == UINT32_MAX || size <= offset) {
+              continue;
+            }
+            target.pushConstantRanges.emplace_back(
+                vk::PushConstantRange()
+                    .setStageFlags(target.stages)
+                    .setOffset(offset)
+                    .setSize(size - offset)
+            );
+          } else if (storageClass == STORAGE_CLASS_INPUT && (target.stages & vk::ShaderStageFlagBits::eVertex)) {
+            if (!decorations.contains(DECORATION_LOCATION) || decorations.contains(DECORATION_BUILT_IN)) {
+              continue;
+            }
+            uint32_t location = decorations.at(DECORATION_LOCATION);
+            uint32_t columns = 1;
+            if (opcodeOf(module, typeId) == OP_TYPE_MATRIX) {
+              columns = module.types.at(typeId).at(3);
+              typeId = module.types.at(typeId).at(2);
+            }
+            for (uint32_t i = 0; i < columns; i++) {
+              attributes[location + i] = format(module, typeId);
+            }
+          }
+        }
+
+        for (auto& [set, bindings] : target.sets) {
+          std::ranges::sort(bindings, {}, &vk::DescriptorSetLayoutBinding::binding);
+        }
+        for (const auto& [location, attributeFormat] : attributes) {
+          target.vertexAttributes.emplace_back(
+              vk::VertexInputAttributeDescription()
+                  .setBinding(0)
+                  .setLocation(location)
+                  .setFormat(attributeFormat)
+                  .setOffset(target.vertexStride)
+          );
+          target.vertexStride += formatSize(attributeFormat);
+        }
+        return target;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    static ShaderReflection merge(const std::vector<ShaderReflection>& reflections) {
+      try {
+        ShaderReflection target = {};
+        for (const ShaderReflection& reflection : reflections) {
+          if (reflection.stages & target.stages) {
+            throw std::invalid_argument(CALL_INFO() + ": duplicate stage: '" + vk::to_string(reflection.stages) + "'!");
+          }
+          target.stages |= reflection.stages;
+          if (target.entryPoint.empty()) {
+            target.entryPoint = reflection.entryPoint;
+          }
+          for (const auto& [set, bindings] : reflection.sets) {
+            std::vector<vk::DescriptorSetLayoutBinding>& targetBindings = target.sets[set];
+            for (const vk::DescriptorSetLayoutBinding& binding : bindings) {
+              auto it = std::ranges::find(targetBindings, binding.binding, &vk::DescriptorSetLayoutBinding::binding);
+              if (it == targetBindings.end()) {
+                targetBindings.emplace_back(binding);
+                continue;
+              }
+              if (it->descriptorType != binding.descriptorType) {
+                throw std::invalid_argument(
+                    CALL_INFO() + ": set: " + std::to_string(set) + " binding: " + std::to_string(binding.binding)
+                    + " type mismatch: '" + vk::to_string(it->descriptorType) + "' != '" + vk::to_string(binding.descriptorType) + "'!"
+                );
+              }
+              it->descriptorCount = std::max(it->descriptorCount, binding.descriptorCount);
+              it->stageFlags |= binding.stageFlags;
+            }
+            std::ranges::sort(targetBindings, {}, &vk::DescriptorSetLayoutBinding::binding);
+          }
+          for (const vk::PushConstantRange& range : reflection.pushConstantRanges) {
+            auto it = std::ranges::find_if(target.pushConstantRanges, [&range](const auto& o) { return o.offset == range.offset && o.size == range.size; });
+            if (it == target.pushConstantRanges.end()) {
+              target.pushConstantRanges.emplace_back(range);
+            } else {
+              it->stageFlags |= range.stageFlags;
+            }
+          }
+          if (reflection.stages & vk::ShaderStageFlagBits::eVertex) {
+            target.vertexAttributes = reflection.vertexAttributes;
+            target.vertexStride = reflection.vertexStride;
+          }
+        }
+        return target;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::ShaderStageFlags stages;
+    std::string entryPoint;
+    std::map<uint32_t, std::vector<vk::DescriptorSetLayoutBinding>> sets;
+    std::vector<vk::PushConstantRange> pushConstantRanges;
+    std::vector<vk::VertexInputAttributeDescription> vertexAttributes;
+    uint32_t vertexStride = 0;
+
+    uint32_t setCount() {
+      try {
+        return sets.empty() ? 0 : sets.rbegin()->first + 1;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::vector<vk::DescriptorSetLayoutBinding> setBindings(const uint32_t& set) {
+      try {
+        auto it = sets.find(set);
+        if (it == sets.end()) {
+          return {};
+        }
+        return it->second;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::VertexInputBindingDescription vertexBindingDescription() {
+      try {
+        return vk::VertexInputBindingDescription()
+            .setBinding(0)
+            .setStride(vertexStride)
+            .setInputRate(vk::VertexInputRate::eVertex);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      struct Module {
+
+        std::map<uint32_t, std::vector<uint32_t>> types;
+        std::map<uint32_t, std::map<uint32_t, uint32_t>> decorations;
+        std::map<uint32_t, std::map<uint32_t, std::map<uint32_t, uint32_t>>> memberDecorations;
+
+      };
+
+      static vk::ShaderStageFlags stage(const uint32_t& executionModel) {
+        switch (executionModel) {
+          case 0:
+            return vk::ShaderStageFlagBits::eVertex;
+          case 1:
+            return vk::ShaderStageFlagBits::eTessellationControl;
+          case 2:
+            return vk::ShaderStageFlagBits::eTessellationEvaluation;
+          case 3:
+            return vk::ShaderStageFlagBits::eGeometry;
+          case 4:
+            return vk::ShaderStageFlagBits::eFragment;
+          case 5:
+            return vk::ShaderStageFlagBits::eCompute;
+          default:
+            throw std::invalid_argument(CALL_INFO() + ": unsupported execution model: " + std::to_string(executionModel) + "!");
+        }
+      }
+
+      static std::string literal(const std::vector<uint32_t>& words, const size_t& first) {
+        std::string result;
+        for (size_t i = first; i < words.size(); i++) {
+          for (uint32_t shift = 0; shift < 32; shift += 8) {
+            char c = static_cast<char>((words[i] >> shift) & 0xFF);
+            if (c == '\0') {
+              return result;
+            }
+            result += c;
+          }
+        }
+        return result;
+      }
+
+      static uint32_t opcodeOf(const Module& module, const uint32_t& typeId) {
+        return module.types.at(typeId).at(0) & 0xFFFF;
+      }
+
+      static std::optional<vk::DescriptorType> toDescriptorType(Module& module, const uint32_t& typeId, const uint32_t& storageClass) {
+        const std::vector<uint32_t>& type = module.types.at(typeId);
+        uint32_t typeOpcode = opcodeOf(module, typeId);
+        if (storageClass == STORAGE_CLASS_STORAGE_BUFFER) {
+          return vk::DescriptorType::eStorageBuffer;
+        } else if (storageClass == STORAGE_CLASS_UNIFORM) {
+          return module.decorations[typeId].contains(DECORATION_BUFFER_BLOCK) ? vk::DescriptorType::eStorageBuffer : vk::DescriptorType::eUniformBuffer;
+        } else if (typeOpcode == OP_TYPE_SAMPLER) {
+          return vk::DescriptorType::eSampler;
+        } else if (typeOpcode == OP_TYPE_SAMPLED_IMAGE) {
+          return vk::DescriptorType::eCombinedImageSampler;
+        } else if (typeOpcode == OP_TYPE_ACCELERATION_STRUCTURE) {
+          return vk::DescriptorType::eAccelerationStructureKHR;
+        } else if (typeOpcode == OP_TYPE_IMAGE && type.size() >= 8) {
+          uint32_t dim = type[3];
+          uint32_t sampled = type[7];
+          if (dim == 5) {
+            return sampled == 2 ? vk::DescriptorType::eStorageTexelBuffer : vk::DescriptorType::eUniformTexelBuffer;
+          } else if (dim == 6) {
+            return vk::DescriptorType::eInputAttachment;
+          }
+          return sampled == 2 ? vk::DescriptorType::eStorageImage : vk::DescriptorType::eSampledImage;
+        }
+        return std::nullopt;
+      }
+
+      static uint32_t sizeOf(Module& module, const uint32_t& typeId) {
+        const std::vector<uint32_t>& type = module.types.at(typeId);
+        switch (opcodeOf(module, typeId)) {
+          case OP_TYPE_BOOL:
+            return 4;
+          case OP_TYPE_INT:
+          case OP_TYPE_FLOAT:
+            return type.at(2) / 8;
+          case OP_TYPE_VECTOR:
+          case OP_TYPE_MATRIX:
+            return sizeOf(module, type.at(2)) * type.at(3);
+          case OP_TYPE_ARRAY: {
+            std::map<uint32_t, uint32_t>& decorations = module.decorations[typeId];
+            uint32_t stride = decorations.contains(DECORATION_ARRAY_STRIDE) ? decorations.at(DECORATION_ARRAY_STRIDE) : sizeOf(module, type.at(2));
+            return stride * module.types.at(type.at(3)).at(3);
+          }
+          case OP_TYPE_STRUCT: {
+            uint32_t size = 0;
+            for (size_t i = 2; i < type.size(); i++) {
+              std::map<uint32_t, uint32_t>& decorations = module.memberDecorations[typeId][static_cast<uint32_t>(i - 2)];
+              uint32_t memberSize = sizeOf(module, type[i]);
+              if (opcodeOf(module, type[i]) == OP_TYPE_MATRIX && decorations.contains(DECORATION_MATRIX_STRIDE)) {
+                memberSize = decorations.at(DECORATION_MATRIX_STRIDE) * module.types.at(type[i]).at(3);
+              }
+              uint32_t offset = decorations.contains(DECORATION_OFFSET) ? decorations.at(DECORATION_OFFSET) : size;
+              size = std::max(size, offset + memberSize);
+            }
+            return size;
+          }
+          default:
+            return 0;
+        }
+      }
+
+      static vk::Format format(const Module& module, const uint32_t& typeId) {
+        uint32_t componentCount = 1;
+        uint32_t componentTypeId = typeId;
+        if (opcodeOf(module, typeId) == OP_TYPE_VECTOR) {
+          componentCount = module.types.at(typeId).at(3);
+          componentTypeId = module.types.at(typeId).at(2);
+        }
+        const std::vector<uint32_t>& componentType = module.types.at(componentTypeId);
+        if (componentType.at(2) != 32 || componentCount < 1 || componentCount > 4) {
+          return vk::Format::eUndefined;
+        }
+        if (opcodeOf(module, componentTypeId) == OP_TYPE_FLOAT) {
+          return std::vector<vk::Format> {vk::Format::eR32Sfloat, vk::Format::eR32G32Sfloat, vk::Format::eR32G32B32Sfloat, vk::Format::eR32G32B32A32Sfloat}.at(componentCount - 1);
+        } else if (opcodeOf(module, componentTypeId) == OP_TYPE_INT && componentType.at(3) == 1) {
+          return std::vector<vk::Format> {vk::Format::eR32Sint, vk::Format::eR32G32Sint, vk::Format::eR32G32B32Sint, vk::Format::eR32G32B32A32Sint}.at(componentCount - 1);
+        } else if (opcodeOf(module, componentTypeId) == OP_TYPE_INT) {
+          return std::vector<vk::Format> {vk::Format::eR32Uint, vk::Format::eR32G32Uint, vk::Format::eR32G32B32Uint, vk::Format::eR32G32B32A32Uint}.at(componentCount - 1);
+        }
+        return vk::Format::eUndefined;
+      }
+
+      static uint32_t formatSize(const vk::Format& format) {
+        switch (format) {
+          case vk::Format::eR32Sfloat:
+          case vk::Format::eR32Sint:
+          case vk::Format::eR32Uint:
+            return 4;
+          case vk::Format::eR32G32Sfloat:
+          case vk::Format::eR32G32Sint:
+          case vk::Format::eR32G32Uint:
+            return 8;
+          case vk::Format::eR32G32B32Sfloat:
+          case vk::Format::eR32G32B32Sint:
+          case vk::Format::eR32G32B32Uint:
+            return 12;
+          case vk::Format::eR32G32B32A32Sfloat:
+          case vk::Format::eR32G32B32A32Sint:
+          case vk::Format::eR32G32B32A32Uint:
+            return 16;
+          default:
+            return 0;
+        }
+      }
+
+  };
+
+}
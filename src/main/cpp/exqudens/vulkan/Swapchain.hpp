@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <utility>
 #include <vector>
 #include <set>
 #include <memory>
@@ -9,6 +11,7 @@
 #include <vulkan/vulkan_raii.hpp>
 
 #include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
 
 namespace exqudens::vulkan {
 
@@ -20,6 +23,7 @@ namespace exqudens::vulkan {
 
     std::vector<uint32_t> queueFamilyIndices;
     vk::SwapchainCreateInfoKHR createInfo;
+    std::weak_ptr<Tracer> tracer;
     std::shared_ptr<vk::raii::SwapchainKHR> value;
 
     vk::raii::SwapchainKHR& reference() {
@@ -33,6 +37,19 @@ namespace exqudens::vulkan {
       }
     }
 
+    std::pair<vk::Result, uint32_t> acquireNextImage(const uint64_t& timeout, const vk::Semaphore& semaphore = {}, const vk::Fence& fence = {}) {
+      try {
+        TRACE_SCOPE(tracer, "swapchainAcquire");
+        try {
+          return reference().acquireNextImage(timeout, semaphore, fence);
+        } catch (const vk::OutOfDateKHRError&) {
+          return {vk::Result::eErrorOutOfDateKHR, 0};
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
   };
 
   class Swapchain::Builder {
@@ -42,6 +59,8 @@ namespace exqudens::vulkan {
       std::weak_ptr<vk::raii::Device> device;
       std::set<uint32_t> queueFamilyIndices;
       std::optional<vk::SwapchainCreateInfoKHR> createInfo;
+      std::weak_ptr<vk::raii::SwapchainKHR> oldSwapchain;
+      std::weak_ptr<Tracer> tracer;
 
     public:
 
@@ -81,11 +100,22 @@ namespace exqudens::vulkan {
         return *this;
       }
 
+      Swapchain::Builder& setOldSwapchain(const std::weak_ptr<vk::raii::SwapchainKHR>& val) {
+        oldSwapchain = val;
+        return *this;
+      }
+
+      Swapchain::Builder& setTracer(const std::weak_ptr<Tracer>& val) {
+        tracer = val;
+        return *this;
+      }
+
       Swapchain build() {
         try {
           Swapchain target = {};
           target.queueFamilyIndices = std::vector<uint32_t>(queueFamilyIndices.begin(), queueFamilyIndices.end());
           target.createInfo = createInfo.value();
+          target.tracer = tracer;
 
           if (target.queueFamilyIndices.size() == 2 && target.queueFamilyIndices[0] != target.queueFamilyIndices[1]) {
             target.createInfo.setImageSharingMode(vk::SharingMode::eConcurrent);
@@ -94,10 +124,15 @@ namespace exqudens::vulkan {
             target.createInfo.setImageSharingMode(vk::SharingMode::eExclusive);
           }
 
+          if (!oldSwapchain.expired()) {
+            target.createInfo.setOldSwapchain(**oldSwapchain.lock());
+          }
+
           target.value = std::make_shared<vk::raii::SwapchainKHR>(
               *device.lock(),
               target.createInfo
           );
+          target.createInfo.setOldSwapchain(nullptr);
           return target;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <optional>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "exqudens/vulkan/Macros.hpp"
+
+#ifndef TRACE_CONCAT
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#endif
+
+#ifndef TRACE_SCOPE
+#if defined(EXQUDENS_VULKAN_TRACE)
+#define TRACE_SCOPE(tracer, name) exqudens::vulkan::Tracer::Scope TRACE_CONCAT(traceScope, __LINE__)(tracer, name)
+#else
+#define TRACE_SCOPE(tracer, name)
+#endif
+#endif
+
+#ifndef TRACE_RECORD
+#if defined(EXQUDENS_VULKAN_TRACE)
+#define TRACE_RECORD(tracer, name, begin, end) do { if (auto traceLock = (tracer).lock()) traceLock->record(name, "cpu", begin, end); } while (false)
+#else
+#define TRACE_RECORD(tracer, name, begin, end)
+#endif
+#endif
+
+namespace exqudens::vulkan {
+
+  struct Tracer {
+
+    class Builder;
+
+    static Builder builder();
+
+    inline static const uint64_t GPU_THREAD_ID = 0;
+
+    struct Event {
+
+      std::string name;
+      std::string category;
+      uint64_t threadId = 0;
+      int64_t begin = 0;
+      int64_t duration = 0;
+
+    };
+
+    class Scope {
+
+      public:
+
+        Scope(const std::weak_ptr<Tracer>& tracer, const char* name):
+            tracer(tracer.lock()),
+            name(name),
+            begin(std::chrono::steady_clock::now())
+        {
+        }
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope() {
+          try {
+            if (tracer) {
+              tracer->record(name, "cpu", begin, std::chrono::steady_clock::now());
+            }
+          } catch (...) {
+          }
+        }
+
+      private:
+
+        std::shared_ptr<Tracer> tracer;
+        const char* name;
+        std::chrono::steady_clock::time_point begin;
+
+    };
+
+    static std::string escape(const std::string& value) {
+      try {
+        std::string result;
+        result.reserve(value.size());
+        for (const char& c : value) {
+          if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+          } else if (static_cast<unsigned char>(c) < 0x20) {
+            result += ' ';
+          } else {
+            result += c;
+          }
+        }
+        return result;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::chrono::steady_clock::time_point origin;
+    size_t maxEvents = 0;
+    std::vector<Event> events;
+    std::optional<int64_t> gpuOffset;
+    uint64_t droppedEvents = 0;
+    std::shared_ptr<std::mutex> mutex;
+
+    int64_t now() {
+      try {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void record(
+        const std::string& name,
+        const std::string& category,
+        const std::chrono::steady_clock::time_point& begin,
+        const std::chrono::steady_clock::time_point& end
+    ) {
+      try {
+        add(
+            Event {
+                .name = name,
+                .category = category,
+                .threadId = std::hash<std::thread::id>()(std::this_thread::get_id()) % 0x7FFFFFFF + 1,
+                .begin = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - origin).count(),
+                .duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()
+            }
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void calibrate(const int64_t& gpuTime, const std::chrono::steady_clock::time_point& cpuTime) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        gpuOffset = std::chrono::duration_cast<std::chrono::nanoseconds>(cpuTime - origin).count() - gpuTime;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void recordGpu(const std::string& name, const int64_t& begin, const int64_t& end) {
+      try {
+        std::optional<int64_t> offset = {};
+        {
+          std::lock_guard<std::mutex> lock(*mutex);
+          offset = gpuOffset;
+        }
+        if (!offset.has_value()) {
+          throw std::runtime_error(CALL_INFO() + ": gpu clock is not calibrated!");
+        }
+        add(
+            Event {
+                .name = name,
+                .category = "gpu",
+                .threadId = GPU_THREAD_ID,
+                .begin = begin + offset.value(),
+                .duration = end - begin
+            }
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void add(const Event& event) {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        if (events.size() >= maxEvents) {
+          droppedEvents++;
+          return;
+        }
+        events.emplace_back(event);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    std::string toJson() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(3);
+        stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << GPU_THREAD_ID << ",\"args\":{\"name\":\"GPU\"}}";
+        for (const Event& event : events) {
+          stream << ",{\"name\":\"" << escape(event.name) << "\"";
+          stream << ",\"cat\":\"" << escape(event.category) << "\"";
+          stream << ",\"ph\":\"X\",\"pid\":0";
+          stream << ",\"tid\":" << event.threadId;
+          stream << ",\"ts\":" << static_cast<double>(event.begin) / 1000.0;
+          stream << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0;
+          stream << "}";
+        }
+        stream << "]}";
+        return stream.str();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void write(const std::string& path) {
+      try {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to open file: '" + path + "'!");
+        }
+        file << toJson();
+        file.close();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void clear() {
+      try {
+        std::lock_guard<std::mutex> lock(*mutex);
+        events.clear();
+        droppedEvents = 0;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class Tracer::Builder {
+
+    private:
+
+      std::optional<size_t> maxEvents;
+
+    public:
+
+      Tracer::Builder& setMaxEvents(const size_t& val) {
+        maxEvents = val;
+        return *this;
+      }
+
+      Tracer build() {
+        try {
+          Tracer target = {};
+          target.origin = std::chrono::steady_clock::now();
+          target.maxEvents = maxEvents.value_or(1024 * 1024);
+          target.events.reserve(std::min<size_t>(target.maxEvents, 64 * 1024));
+          target.mutex = std::make_shared<std::mutex>();
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  Tracer::Builder Tracer::builder() {
+    return {};
+  }
+
+}
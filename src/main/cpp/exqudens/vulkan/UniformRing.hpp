@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <optional>
+#include <memory>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+#include "exqudens/vulkan/MemoryAllocator.hpp"
+#include "exqudens/vulkan/Buffer.hpp"
+
+namespace exqudens::vulkan {
+
+  struct UniformRing {
+
+    class Builder;
+
+    static Builder builder();
+
+    vk::DeviceSize alignment = 1;
+    vk::DeviceSize frameSize = 0;
+    uint32_t frameCount = 0;
+    Buffer buffer;
+    void* data = nullptr;
+    vk::DeviceSize frameBegin = 0;
+    vk::DeviceSize head = 0;
+
+    vk::raii::Buffer& reference() {
+      try {
+        return buffer.reference();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void beginFrame(const uint32_t& frameIndex) {
+      try {
+        if (frameIndex >= frameCount) {
+          throw std::runtime_error(CALL_INFO() + ": frameIndex: " + std::to_string(frameIndex) + " is out of range!");
+        }
+        frameBegin = frameIndex * frameSize;
+        head = frameBegin;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint32_t push(const void* src, const vk::DeviceSize& size) {
+      try {
+        if (data == nullptr) {
+          throw std::runtime_error(CALL_INFO() + ": data is not mapped!");
+        }
+        vk::DeviceSize offset = MemoryBlock::alignUp(head, alignment);
+        if (offset + size > frameBegin + frameSize) {
+          throw std::runtime_error(CALL_INFO() + ": frame region is full!");
+        }
+        std::memcpy(static_cast<char*>(data) + offset, src, static_cast<size_t>(size));
+        head = offset + size;
+        return static_cast<uint32_t>(offset);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    template<typename T>
+    uint32_t push(const T& value) {
+      try {
+        return push(&value, sizeof(T));
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    vk::DescriptorBufferInfo descriptorBufferInfo(const vk::DeviceSize& range) {
+      try {
+        return vk::DescriptorBufferInfo()
+            .setBuffer(*reference())
+            .setOffset(0)
+            .setRange(range);
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  };
+
+  class UniformRing::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::optional<vk::DeviceSize> frameSize;
+      std::optional<uint32_t> frameCount;
+
+    public:
+
+      UniformRing::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      UniformRing::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      UniformRing::Builder& setFrameSize(const vk::DeviceSize& val) {
+        frameSize = val;
+        return *this;
+      }
+
+      UniformRing::Builder& setFrameCount(const uint32_t& val) {
+        frameCount = val;
+        return *this;
+      }
+
+      UniformRing build() {
+        try {
+          UniformRing target = {};
+          target.alignment = physicalDevice.lock()->getProperties().limits.minUniformBufferOffsetAlignment;
+          target.frameSize = MemoryBlock::alignUp(frameSize.value_or(64 * 1024), target.alignment);
+          target.frameCount = frameCount.value_or(2);
+
+          std::shared_ptr<MemoryTypeSelector> memoryTypeSelector = MemoryTypeSelector::shared(physicalDevice);
+
+          target.buffer = Buffer::builder()
+              .setPhysicalDevice(physicalDevice)
+              .setDevice(device)
+              .setMemoryTypeIndexFunction(
+                  [memoryTypeSelector](
+                      vk::raii::PhysicalDevice&,
+                      const uint32_t& typeBits,
+                      const vk::MemoryPropertyFlags&
+                  ) -> uint32_t {
+                    return memoryTypeSelector->uniformMemoryTypeIndex(typeBits);
+                  }
+              )
+              .setCreateInfo(
+                  vk::BufferCreateInfo()
+                      .setSize(target.frameSize * target.frameCount)
+                      .setUsage(vk::BufferUsageFlagBits::eUniformBuffer)
+                      .setSharingMode(vk::SharingMode::eExclusive)
+              )
+              .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+          .build();
+          target.data = target.buffer.mapMemory(0, target.buffer.createInfo.size);
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  UniformRing::Builder UniformRing::builder() {
+    return {};
+  }
+
+}
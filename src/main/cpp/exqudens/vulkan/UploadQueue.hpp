@@ -0,0 +1,538 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Buffer.hpp"
+
+namespace exqudens::vulkan {
+
+  struct UploadQueue {
+
+    class Builder;
+
+    static Builder builder();
+
+    struct BufferCopy {
+
+      vk::Buffer dst;
+      vk::BufferCopy region;
+      vk::AccessFlags dstAccessMask;
+      vk::PipelineStageFlags dstStageMask;
+
+    };
+
+    struct ImageCopy {
+
+      vk::Image dst;
+      vk::BufferImageCopy region;
+      vk::ImageSubresourceRange subresourceRange;
+      vk::ImageLayout layout;
+      vk::AccessFlags dstAccessMask;
+      vk::PipelineStageFlags dstStageMask;
+
+    };
+
+    struct Ring {
+
+      vk::DeviceSize capacity = 0;
+      vk::DeviceSize alignment = 16;
+      vk::DeviceSize head = 0;
+      vk::DeviceSize tail = 0;
+
+      std::optional<vk::DeviceSize> reserve(const vk::DeviceSize& size, const bool& empty) {
+        try {
+          if (empty) {
+            head = 0;
+            tail = 0;
+          }
+          vk::DeviceSize offset = (head + alignment - 1) / alignment * alignment;
+          if (empty || head > tail) {
+            if (offset + size <= capacity) {
+              head = offset + size;
+              return offset;
+            }
+            if (size <= tail) {
+              head = size;
+              return 0;
+            }
+          } else if (head < tail && offset + size <= tail) {
+            head = offset + size;
+            return offset;
+          }
+          return std::nullopt;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void retire(const vk::DeviceSize& end) {
+        tail = end;
+      }
+
+    };
+
+    struct Batch {
+
+      uint64_t id = 0;
+      std::shared_ptr<vk::raii::CommandBuffer> commandBuffer;
+      std::shared_ptr<vk::raii::Fence> fence;
+      vk::DeviceSize end = 0;
+      std::vector<vk::BufferMemoryBarrier> bufferAcquireBarriers;
+      std::vector<vk::ImageMemoryBarrier> imageAcquireBarriers;
+      vk::PipelineStageFlags dstStageMask;
+
+    };
+
+    std::weak_ptr<vk::raii::Device> device;
+    std::weak_ptr<vk::raii::Queue> queue;
+    uint32_t srcQueueFamilyIndex = 0;
+    uint32_t dstQueueFamilyIndex = 0;
+    Ring ring;
+    Buffer stagingBuffer;
+    void* stagingData = nullptr;
+    std::shared_ptr<vk::raii::CommandPool> commandPool;
+    std::vector<Batch> batches;
+    std::deque<size_t> freeBatches;
+    std::deque<size_t> inFlightBatches;
+    std::vector<BufferCopy> pendingBufferCopies;
+    std::vector<ImageCopy> pendingImageCopies;
+    std::vector<vk::BufferMemoryBarrier> bufferAcquireBarriers;
+    std::vector<vk::ImageMemoryBarrier> imageAcquireBarriers;
+    vk::PipelineStageFlags acquireDstStageMask;
+    uint64_t nextId = 1;
+    uint64_t completedId = 0;
+
+    void uploadBuffer(
+        const void* data,
+        const vk::DeviceSize& size,
+        const vk::Buffer& dst,
+        const vk::DeviceSize& dstOffset,
+        const vk::AccessFlags& dstAccessMask,
+        const vk::PipelineStageFlags& dstStageMask
+    ) {
+      try {
+        vk::DeviceSize offset = stage(data, size);
+        pendingBufferCopies.emplace_back(
+            BufferCopy {
+                .dst = dst,
+                .region = vk::BufferCopy()
+                    .setSrcOffset(offset)
+                    .setDstOffset(dstOffset)
+                    .setSize(size),
+                .dstAccessMask = dstAccessMask,
+                .dstStageMask = dstStageMask
+            }
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void uploadImage(
+        const void* data,
+        const vk::DeviceSize& size,
+        const vk::Image& dst,
+        const vk::BufferImageCopy& region,
+        const vk::ImageLayout& layout,
+        const vk::AccessFlags& dstAccessMask,
+        const vk::PipelineStageFlags& dstStageMask
+    ) {
+      try {
+        vk::DeviceSize offset = stage(data, size);
+        pendingImageCopies.emplace_back(
+            ImageCopy {
+                .dst = dst,
+                .region = vk::BufferImageCopy(region).setBufferOffset(offset),
+                .subresourceRange = vk::ImageSubresourceRange()
+                    .setAspectMask(region.imageSubresource.aspectMask)
+                    .setBaseMipLevel(region.imageSubresource.mipLevel)
+                    .setLevelCount(1)
+                    .setBaseArrayLayer(region.imageSubresource.baseArrayLayer)
+                    .setLayerCount(region.imageSubresource.layerCount),
+                .layout = layout,
+                .dstAccessMask = dstAccessMask,
+                .dstStageMask = dstStageMask
+            }
+        );
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    uint64_t flush() {
+      try {
+        if (pendingBufferCopies.empty() && pendingImageCopies.empty()) {
+          return nextId - 1;
+        }
+        if (freeBatches.empty()) {
+          waitOldest();
+        }
+        size_t index = freeBatches.front();
+        freeBatches.pop_front();
+        Batch& batch = batches[index];
+        batch.id = nextId++;
+        batch.end = ring.head;
+        batch.bufferAcquireBarriers.clear();
+        batch.imageAcquireBarriers.clear();
+        batch.dstStageMask = {};
+
+        bool transfer = srcQueueFamilyIndex != dstQueueFamilyIndex;
+        uint32_t srcFamily = transfer ? srcQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        uint32_t dstFamily = transfer ? dstQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+
+        vk::raii::CommandBuffer& commandBuffer = *batch.commandBuffer;
+        commandBuffer.reset();
+        commandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+        if (!pendingImageCopies.empty()) {
+          std::vector<vk::ImageMemoryBarrier> barriers;
+          for (const ImageCopy& copy : pendingImageCopies) {
+            barriers.emplace_back(
+                vk::ImageMemoryBarrier()
+                    .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setImage(copy.dst)
+                    .setOldLayout(vk::ImageLayout::eUndefined)
+                    .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                    .setSrcAccessMask(vk::AccessFlagBits::eNoneKHR)
+                    .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+                    .setSubresourceRange(copy.subresourceRange)
+            );
+          }
+          commandBuffer.pipelineBarrier(
+              vk::PipelineStageFlagBits::eTopOfPipe,
+              vk::PipelineStageFlagBits::eTransfer,
+              vk::DependencyFlags(0),
+              {},
+              {},
+              barriers
+          );
+        }
+
+        for (const BufferCopy& copy : pendingBufferCopies) {
+          commandBuffer.copyBuffer(*stagingBuffer.reference(), copy.dst, {copy.region});
+        }
+        for (const ImageCopy& copy : pendingImageCopies) {
+          commandBuffer.copyBufferToImage(
+              *stagingBuffer.reference(),
+              copy.dst,
+              vk::ImageLayout::eTransferDstOptimal,
+              {copy.region}
+          );
+        }
+
+        std::vector<vk::BufferMemoryBarrier> bufferBarriers;
+        std::vector<vk::ImageMemoryBarrier> imageBarriers;
+        vk::PipelineStageFlags dstStageMask;
+        for (const BufferCopy& copy : pendingBufferCopies) {
+          vk::BufferMemoryBarrier barrier = vk::BufferMemoryBarrier()
+              .setSrcQueueFamilyIndex(srcFamily)
+              .setDstQueueFamilyIndex(dstFamily)
+              .setBuffer(copy.dst)
+              .setOffset(copy.region.dstOffset)
+              .setSize(copy.region.size);
+          bufferBarriers.emplace_back(
+              vk::BufferMemoryBarrier(barrier)
+                  .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                  .setDstAccessMask(transfer ? vk::AccessFlags() : copy.dstAccessMask)
+          );
+          if (transfer) {
+            batch.bufferAcquireBarriers.emplace_back(
+                vk::BufferMemoryBarrier(barrier)
+                    .setSrcAccessMask(vk::AccessFlags())
+                    .setDstAccessMask(copy.dstAccessMask)
+            );
+          }
+          dstStageMask |= copy.dstStageMask;
+        }
+        for (const ImageCopy& copy : pendingImageCopies) {
+          vk::ImageMemoryBarrier barrier = vk::ImageMemoryBarrier()
+              .setSrcQueueFamilyIndex(srcFamily)
+              .setDstQueueFamilyIndex(dstFamily)
+              .setImage(copy.dst)
+              .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
+              .setNewLayout(copy.layout)
+              .setSubresourceRange(copy.subresourceRange);
+          imageBarriers.emplace_back(
+              vk::ImageMemoryBarrier(barrier)
+                  .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                  .setDstAccessMask(transfer ? vk::AccessFlags() : copy.dstAccessMask)
+          );
+          if (transfer) {
+            batch.imageAcquireBarriers.emplace_back(
+                vk::ImageMemoryBarrier(barrier)
+                    .setSrcAccessMask(vk::AccessFlags())
+                    .setDstAccessMask(copy.dstAccessMask)
+            );
+          }
+          dstStageMask |= copy.dstStageMask;
+        }
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            transfer ? vk::PipelineStageFlags(vk::PipelineStageFlagBits::eBottomOfPipe) : dstStageMask,
+            vk::DependencyFlags(0),
+            {},
+            bufferBarriers,
+            imageBarriers
+        );
+        batch.dstStageMask = dstStageMask;
+
+        commandBuffer.end();
+
+        device.lock()->resetFences({**batch.fence});
+        std::vector<vk::CommandBuffer> commandBuffers = {*commandBuffer};
+        queue.lock()->submit(
+            {
+                vk::SubmitInfo()
+                    .setCommandBuffers(commandBuffers)
+            },
+            **batch.fence
+        );
+        inFlightBatches.emplace_back(index);
+        pendingBufferCopies.clear();
+        pendingImageCopies.clear();
+        return batch.id;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void poll() {
+      try {
+        while (!inFlightBatches.empty()) {
+          Batch& batch = batches[inFlightBatches.front()];
+          vk::Result result = device.lock()->waitForFences({**batch.fence}, true, 0);
+          if (vk::Result::eSuccess != result) {
+            break;
+          }
+          retireOldest();
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool isComplete(const uint64_t& id) {
+      try {
+        poll();
+        return id <= completedId;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    bool recordAcquire(vk::raii::CommandBuffer& commandBuffer, const uint64_t& id) {
+      try {
+        poll();
+        if (bufferAcquireBarriers.empty() && imageAcquireBarriers.empty()) {
+          return id <= completedId;
+        }
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTopOfPipe,
+            acquireDstStageMask,
+            vk::DependencyFlags(0),
+            {},
+            bufferAcquireBarriers,
+            imageAcquireBarriers
+        );
+        bufferAcquireBarriers.clear();
+        imageAcquireBarriers.clear();
+        acquireDstStageMask = {};
+        return id <= completedId;
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    void waitIdle() {
+      try {
+        flush();
+        while (!inFlightBatches.empty()) {
+          waitOldest();
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    private:
+
+      vk::DeviceSize stage(const void* data, const vk::DeviceSize& size) {
+        try {
+          if (size > stagingBuffer.createInfo.size) {
+            throw std::invalid_argument(CALL_INFO() + ": size greater than staging buffer size!");
+          }
+          std::optional<vk::DeviceSize> offset = ring.reserve(size, isEmpty());
+          while (!offset) {
+            if (!pendingBufferCopies.empty() || !pendingImageCopies.empty()) {
+              flush();
+            }
+            if (!inFlightBatches.empty()) {
+              waitOldest();
+            }
+            offset = ring.reserve(size, isEmpty());
+          }
+          std::memcpy(static_cast<char*>(stagingData) + offset.value(), data, static_cast<size_t>(size));
+          return offset.value();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      bool isEmpty() const {
+        return inFlightBatches.empty() && pendingBufferCopies.empty() && pendingImageCopies.empty();
+      }
+
+      void waitOldest() {
+        try {
+          if (inFlightBatches.empty()) {
+            throw std::runtime_error(CALL_INFO() + ": no batch in flight!");
+          }
+          Batch& batch = batches[inFlightBatches.front()];
+          vk::Result result = device.lock()->waitForFences({**batch.fence}, true, UINT64_MAX);
+          if (vk::Result::eSuccess != result) {
+            throw std::runtime_error(CALL_INFO() + ": failed to 'device.waitForFences(...)'!");
+          }
+          retireOldest();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void retireOldest() {
+        size_t index = inFlightBatches.front();
+        inFlightBatches.pop_front();
+        Batch& batch = batches[index];
+        ring.retire(batch.end);
+        completedId = batch.id;
+        bufferAcquireBarriers.insert(bufferAcquireBarriers.end(), batch.bufferAcquireBarriers.begin(), batch.bufferAcquireBarriers.end());
+        imageAcquireBarriers.insert(imageAcquireBarriers.end(), batch.imageAcquireBarriers.begin(), batch.imageAcquireBarriers.end());
+        if (!batch.bufferAcquireBarriers.empty() || !batch.imageAcquireBarriers.empty()) {
+          acquireDstStageMask |= batch.dstStageMask;
+        }
+        freeBatches.emplace_back(index);
+      }
+
+  };
+
+  class UploadQueue::Builder {
+
+    private:
+
+      std::weak_ptr<vk::raii::PhysicalDevice> physicalDevice;
+      std::weak_ptr<vk::raii::Device> device;
+      std::weak_ptr<vk::raii::Queue> queue;
+      std::optional<uint32_t> srcQueueFamilyIndex;
+      std::optional<uint32_t> dstQueueFamilyIndex;
+      std::optional<vk::DeviceSize> stagingSize;
+      std::optional<uint32_t> batchCount;
+
+    public:
+
+      UploadQueue::Builder& setPhysicalDevice(const std::weak_ptr<vk::raii::PhysicalDevice>& val) {
+        physicalDevice = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setDevice(const std::weak_ptr<vk::raii::Device>& val) {
+        device = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setQueue(const std::weak_ptr<vk::raii::Queue>& val) {
+        queue = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setSrcQueueFamilyIndex(const uint32_t& val) {
+        srcQueueFamilyIndex = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setDstQueueFamilyIndex(const uint32_t& val) {
+        dstQueueFamilyIndex = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setStagingSize(const vk::DeviceSize& val) {
+        stagingSize = val;
+        return *this;
+      }
+
+      UploadQueue::Builder& setBatchCount(const uint32_t& val) {
+        batchCount = val;
+        return *this;
+      }
+
+      UploadQueue build() {
+        try {
+          UploadQueue target = {};
+          target.device = device;
+          target.queue = queue;
+          target.srcQueueFamilyIndex = srcQueueFamilyIndex.value();
+          target.dstQueueFamilyIndex = dstQueueFamilyIndex.value_or(target.srcQueueFamilyIndex);
+          target.ring.alignment = std::max<vk::DeviceSize>(
+              physicalDevice.lock()->getProperties().limits.optimalBufferCopyOffsetAlignment,
+              16
+          );
+          target.stagingBuffer = Buffer::builder()
+              .setPhysicalDevice(physicalDevice)
+              .setDevice(device)
+              .setCreateInfo(
+                  vk::BufferCreateInfo()
+                      .setSize(stagingSize.value_or(64 * 1024 * 1024))
+                      .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
+                      .setSharingMode(vk::SharingMode::eExclusive)
+              )
+              .setMemoryCreateInfo(
+                  vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+              )
+          .build();
+          target.ring.capacity = target.stagingBuffer.createInfo.size;
+          target.stagingData = target.stagingBuffer.mapMemory(0, target.stagingBuffer.createInfo.size);
+          target.commandPool = std::make_shared<vk::raii::CommandPool>(
+              *device.lock(),
+              vk::CommandPoolCreateInfo()
+                  .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer)
+                  .setQueueFamilyIndex(target.srcQueueFamilyIndex)
+          );
+          vk::raii::CommandBuffers commandBuffers = vk::raii::CommandBuffers(
+              *device.lock(),
+              vk::CommandBufferAllocateInfo()
+                  .setCommandPool(**target.commandPool)
+                  .setLevel(vk::CommandBufferLevel::ePrimary)
+                  .setCommandBufferCount(batchCount.value_or(4))
+          );
+          for (size_t i = 0; i < commandBuffers.size(); i++) {
+            Batch batch = {};
+            batch.commandBuffer = std::make_shared<vk::raii::CommandBuffer>(std::move(commandBuffers[i]));
+            batch.fence = std::make_shared<vk::raii::Fence>(
+                *device.lock(),
+                vk::FenceCreateInfo().setFlags(vk::FenceCreateFlagBits::eSignaled)
+            );
+            target.batches.emplace_back(batch);
+            target.freeBatches.emplace_back(i);
+          }
+          return target;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  UploadQueue::Builder UploadQueue::builder() {
+    return {};
+  }
+
+}
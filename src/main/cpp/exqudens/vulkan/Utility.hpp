@@ -199,6 +199,47 @@ namespace exqudens::vulkan {
         }
       }
 
+      static uint32_t formatSize(const vk::Format& format) {
+        try {
+          switch (format) {
+            case vk::Format::eR8Unorm:
+            case vk::Format::eR8Srgb:
+              return 1;
+            case vk::Format::eR8G8Unorm:
+            case vk::Format::eR16Sfloat:
+              return 2;
+            case vk::Format::eR8G8B8A8Unorm:
+            case vk::Format::eR8G8B8A8Srgb:
+            case vk::Format::eB8G8R8A8Unorm:
+            case vk::Format::eB8G8R8A8Srgb:
+            case vk::Format::eR16G16Sfloat:
+            case vk::Format::eR32Sfloat:
+            case vk::Format::eD32Sfloat:
+              return 4;
+            case vk::Format::eR16G16B16A16Sfloat:
+            case vk::Format::eR32G32Sfloat:
+              return 8;
+            case vk::Format::eR32G32B32A32Sfloat:
+              return 16;
+            default:
+              throw std::runtime_error(CALL_INFO() + ": unsupported format: '" + vk::to_string(format) + "'!");
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      static uint32_t groupCount(const uint32_t& size, const uint32_t& localSize) {
+        try {
+          if (localSize == 0) {
+            throw std::invalid_argument(CALL_INFO() + ": localSize is zero!");
+          }
+          return size / localSize + (size % localSize == 0 ? 0 : 1);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       static uint32_t memoryTypeIndex(
           vk::raii::PhysicalDevice& physicalDevice,
           const uint32_t& typeBits,
@@ -208,7 +249,7 @@ namespace exqudens::vulkan {
           vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties();
           for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
             if (
-                (typeBits & 1)
+                ((typeBits >> i) & 1)
                 && ((memoryProperties.memoryTypes[i].propertyFlags & requirementsMask) == requirementsMask)
                 ) {
               return i;
@@ -8,6 +8,28 @@ namespace exqudens::vulkan {
 
   struct WriteDescriptorSet: vk::WriteDescriptorSet {
 
+    WriteDescriptorSet() = default;
+
+    WriteDescriptorSet(const WriteDescriptorSet& other):
+        vk::WriteDescriptorSet(other),
+        imageInfo(other.imageInfo),
+        bufferInfo(other.bufferInfo),
+        texelBufferView(other.texelBufferView)
+    {
+      relink();
+    }
+
+    WriteDescriptorSet& operator=(const WriteDescriptorSet& other) {
+      if (this != &other) {
+        vk::WriteDescriptorSet::operator=(other);
+        imageInfo = other.imageInfo;
+        bufferInfo = other.bufferInfo;
+        texelBufferView = other.texelBufferView;
+        relink();
+      }
+      return *this;
+    }
+
     WriteDescriptorSet& setDstSet(const vk::DescriptorSet& value) {
       vk::WriteDescriptorSet::setDstSet(value);
       return *this;
@@ -55,6 +77,20 @@ namespace exqudens::vulkan {
       return *this;
     }
 
+    private:
+
+      void relink() {
+        if (!imageInfo.empty()) {
+          pImageInfo = imageInfo.data();
+        }
+        if (!bufferInfo.empty()) {
+          pBufferInfo = bufferInfo.data();
+        }
+        if (!texelBufferView.empty()) {
+          pTexelBufferView = texelBufferView.data();
+        }
+      }
+
   };
 
 }
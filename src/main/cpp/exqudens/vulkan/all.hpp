@@ -2,32 +2,50 @@
 
 #include "exqudens/vulkan/Macros.hpp"
 #include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/MappedFile.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
 
 #include "exqudens/vulkan/Instance.hpp"
 #include "exqudens/vulkan/MessengerCreateInfo.hpp"
 #include "exqudens/vulkan/Messenger.hpp"
 #include "exqudens/vulkan/PhysicalDevice.hpp"
 #include "exqudens/vulkan/Device.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+#include "exqudens/vulkan/MemoryAllocator.hpp"
 #include "exqudens/vulkan/Image.hpp"
 #include "exqudens/vulkan/ImageView.hpp"
 #include "exqudens/vulkan/Buffer.hpp"
+#include "exqudens/vulkan/UniformRing.hpp"
 #include "exqudens/vulkan/Sampler.hpp"
 #include "exqudens/vulkan/Semaphore.hpp"
 #include "exqudens/vulkan/Fence.hpp"
 #include "exqudens/vulkan/SubpassDescription.hpp"
 #include "exqudens/vulkan/RenderPass.hpp"
 #include "exqudens/vulkan/DescriptorSetLayout.hpp"
+#include "exqudens/vulkan/DescriptorSetLayoutCache.hpp"
+#include "exqudens/vulkan/ShaderReflection.hpp"
+#include "exqudens/vulkan/ShaderModuleCache.hpp"
 #include "exqudens/vulkan/PipelineVertexInputStateCreateInfo.hpp"
 #include "exqudens/vulkan/PipelineViewportStateCreateInfo.hpp"
 #include "exqudens/vulkan/PipelineColorBlendStateCreateInfo.hpp"
 #include "exqudens/vulkan/GraphicsPipelineCreateInfo.hpp"
+#include "exqudens/vulkan/PipelineCacheStore.hpp"
 #include "exqudens/vulkan/Pipeline.hpp"
+#include "exqudens/vulkan/PipelineCompiler.hpp"
 #include "exqudens/vulkan/DescriptorPool.hpp"
 #include "exqudens/vulkan/WriteDescriptorSet.hpp"
 #include "exqudens/vulkan/DescriptorSet.hpp"
+#include "exqudens/vulkan/DescriptorAllocator.hpp"
+#include "exqudens/vulkan/DescriptorUpdateTemplate.hpp"
+#include "exqudens/vulkan/DescriptorSetCache.hpp"
+#include "exqudens/vulkan/BindlessTable.hpp"
 #include "exqudens/vulkan/Framebuffer.hpp"
 #include "exqudens/vulkan/Queue.hpp"
 #include "exqudens/vulkan/CommandPool.hpp"
 #include "exqudens/vulkan/CommandBuffer.hpp"
+#include "exqudens/vulkan/GpuProfiler.hpp"
 #include "exqudens/vulkan/Surface.hpp"
 #include "exqudens/vulkan/Swapchain.hpp"
+#include "exqudens/vulkan/UploadQueue.hpp"
+#include "exqudens/vulkan/OffscreenTarget.hpp"
+#include "exqudens/vulkan/FrameRing.hpp"
@@ -4,8 +4,31 @@
 #include <gtest/gtest.h>
 
 #include "TestConfiguration.hpp"
+#include "TestContext.hpp"
 #include "exqudens/vulkan/TestUtilsTests.hpp"
 #include "exqudens/vulkan/OtherTests.hpp"
+#include "exqudens/vulkan/MemoryAllocatorTests.hpp"
+#include "exqudens/vulkan/MemoryTypeSelectorTests.hpp"
+#include "exqudens/vulkan/UploadQueueTests.hpp"
+#include "exqudens/vulkan/GpuProfilerTests.hpp"
+#include "exqudens/vulkan/TracerTests.hpp"
+#include "exqudens/vulkan/MessengerTests.hpp"
+#include "exqudens/vulkan/PipelineCacheStoreTests.hpp"
+#include "exqudens/vulkan/ShaderReflectionTests.hpp"
+#include "exqudens/vulkan/ShaderModuleCacheTests.hpp"
+#include "exqudens/vulkan/MappedFileTests.hpp"
+#include "exqudens/vulkan/GraphicsPipelineCreateInfoTests.hpp"
+#include "exqudens/vulkan/PipelineCompilerTests.hpp"
+#include "exqudens/vulkan/PipelineTests.hpp"
+#include "exqudens/vulkan/CommandBufferTests.hpp"
+#include "exqudens/vulkan/DescriptorSetTests.hpp"
+#include "exqudens/vulkan/OffscreenTargetTests.hpp"
+#include "exqudens/vulkan/FrameRingTests.hpp"
+#include "exqudens/vulkan/UniformRingTests.hpp"
+#include "exqudens/vulkan/DescriptorAllocatorTests.hpp"
+#include "exqudens/vulkan/DescriptorUpdateTemplateTests.hpp"
+#include "exqudens/vulkan/BindlessTableTests.hpp"
+#include "exqudens/vulkan/DescriptorSetCacheTests.hpp"
 //#include "exqudens/vulkan/ConfigurationTests.hpp"
 //#include "exqudens/vulkan/ShaderTests.hpp"
 //#include "exqudens/vulkan/FactoryTests.hpp"
@@ -23,7 +46,9 @@ class TestApplication {
       TestConfiguration::setExecutableFile(argv[0]);
       testing::InitGoogleMock(argc, argv);
       testing::InitGoogleTest(argc, argv);
-      return RUN_ALL_TESTS();
+      int result = RUN_ALL_TESTS();
+      TestContext::destroy();
+      return result;
     }
 
 };
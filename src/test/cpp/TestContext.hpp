@@ -0,0 +1,166 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+#include <vulkan/vulkan_raii.hpp>
+
+#include "TestMacros.hpp"
+#include "TestConfiguration.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+class TestContext {
+
+  public:
+
+    static TestContext& get() {
+      try {
+        if (!value()) {
+          value() = std::make_unique<TestContext>();
+          value()->create();
+        }
+        return *value();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    // call before the first get(), benchmarks run without the validation layer
+    static void setValidation(const bool& val) {
+      validation() = val;
+    }
+
+    static void destroy() {
+      try {
+        if (value()) {
+          value()->device.reference().waitIdle();
+          value().reset();
+        }
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+    exqudens::vulkan::Instance instance = {};
+    exqudens::vulkan::PhysicalDevice physicalDevice = {};
+    exqudens::vulkan::Device device = {};
+    exqudens::vulkan::Queue transferQueue = {};
+    exqudens::vulkan::Queue graphicsQueue = {};
+    exqudens::vulkan::CommandPool graphicsCommandPool = {};
+
+    void submit(const std::function<void(vk::raii::CommandBuffer&)>& function) {
+      try {
+        using namespace exqudens::vulkan;
+
+        CommandBuffer commandBuffer = CommandBuffer::builder()
+            .setDevice(device.value)
+            .setCreateInfo(
+                vk::CommandBufferAllocateInfo()
+                    .setCommandPool(*graphicsCommandPool.reference())
+                    .setCommandBufferCount(1)
+                    .setLevel(vk::CommandBufferLevel::ePrimary)
+            )
+        .build();
+
+        commandBuffer.reference().begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+        function(commandBuffer.reference());
+        commandBuffer.reference().end();
+
+        graphicsQueue.reference().submit({vk::SubmitInfo().setCommandBuffers(*commandBuffer.reference())});
+        graphicsQueue.reference().waitIdle();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+  private:
+
+    static std::unique_ptr<TestContext>& value() {
+      static std::unique_ptr<TestContext> object = {};
+      return object;
+    }
+
+    static bool& validation() {
+      static bool object = true;
+      return object;
+    }
+
+    void create() {
+      try {
+        using namespace exqudens::vulkan;
+
+        std::vector<const char*> enabledLayerNames = {};
+        if (validation()) {
+          Utility::setEnvironmentVariable("VK_LAYER_PATH", TestConfiguration::getExecutableDir());
+          enabledLayerNames.emplace_back("VK_LAYER_KHRONOS_validation");
+        }
+
+        instance = Instance::builder()
+            .setOut(std::cout)
+            .setEnabledLayerNames(enabledLayerNames)
+            .addEnabledExtensionName(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+            .setApplicationInfo(
+                vk::ApplicationInfo()
+                    .setPApplicationName("Exqudens Test")
+                    .setApplicationVersion(VK_MAKE_VERSION(1, 0, 0))
+                    .setPEngineName("Exqudens Engine")
+                    .setEngineVersion(VK_MAKE_VERSION(1, 0, 0))
+                    .setApiVersion(VK_API_VERSION_1_1)
+            )
+            .setMessengerCreateInfo(
+                MessengerCreateInfo()
+                    .setExceptionSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eError)
+                    .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning)
+                    .setToStringFunction(&Utility::toString)
+            )
+            .setDebugUtilsMessengerCreateInfo(
+                vk::DebugUtilsMessengerCreateInfoEXT()
+                    .setMessageSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning | vk::DebugUtilsMessageSeverityFlagBitsEXT::eError)
+                    .setMessageType(vk::DebugUtilsMessageTypeFlagBitsEXT::eGeneral | vk::DebugUtilsMessageTypeFlagBitsEXT::eValidation | vk::DebugUtilsMessageTypeFlagBitsEXT::ePerformance)
+            )
+        .build();
+
+        physicalDevice = PhysicalDevice::builder()
+            .setInstance(instance.value)
+            .addQueueType(vk::QueueFlagBits::eTransfer)
+            .addQueueType(vk::QueueFlagBits::eGraphics)
+            .setQueuePriority(1.0f)
+        .build();
+
+        device = Device::builder()
+            .setPhysicalDevice(physicalDevice)
+            .setCreateInfo(
+                vk::DeviceCreateInfo()
+                    .setQueueCreateInfos(physicalDevice.uniqueQueueCreateInfos)
+                    .setPEnabledFeatures(&physicalDevice.features)
+                    .setPEnabledExtensionNames(physicalDevice.enabledExtensionNames)
+                    .setPEnabledLayerNames(instance.enabledLayerNames)
+            )
+        .build();
+
+        transferQueue = Queue::builder()
+            .setDevice(device.value)
+            .setFamilyIndex(physicalDevice.transferQueueCreateInfos.front().queueFamilyIndex)
+        .build();
+        graphicsQueue = Queue::builder()
+            .setDevice(device.value)
+            .setFamilyIndex(physicalDevice.graphicsQueueCreateInfos.front().queueFamilyIndex)
+        .build();
+
+        graphicsCommandPool = CommandPool::builder()
+            .setDevice(device.value)
+            .setCreateInfo(
+                vk::CommandPoolCreateInfo()
+                    .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer)
+                    .setQueueFamilyIndex(graphicsQueue.familyIndex)
+            )
+        .build();
+      } catch (...) {
+        std::throw_with_nested(std::runtime_error(CALL_INFO()));
+      }
+    }
+
+};
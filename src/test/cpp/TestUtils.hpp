@@ -12,6 +12,7 @@
 
 #include "TestMacros.hpp"
 #include "TestConfiguration.hpp"
+#include "exqudens/vulkan/MappedFile.hpp"
 
 class TestUtils {
 
@@ -133,7 +134,17 @@ class TestUtils {
         unsigned int heightIn = 0;
         unsigned int depthIn = 4;
         std::vector<unsigned char> dataIn;
-        unsigned int error = lodepng::decode(dataIn, widthIn, heightIn, path);
+        exqudens::vulkan::MappedFile file = exqudens::vulkan::MappedFile::builder()
+            .setPath(path)
+            .setPrefetch(true)
+        .build();
+        unsigned int error = lodepng::decode(
+            dataIn,
+            widthIn,
+            heightIn,
+            reinterpret_cast<const unsigned char*>(file.bytes().data()),
+            file.bytes().size()
+        );
         if (error) {
           throw std::runtime_error(
               CALL_INFO() + ": failed to read image '" + std::to_string(error) + "': " + lodepng_error_text(error)
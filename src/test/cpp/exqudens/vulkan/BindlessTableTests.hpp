@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class BindlessTableTests : public testing::Test {
+  };
+
+  TEST_F(BindlessTableTests, test1) {
+    try {
+      BindlessTable::Slots slots = {};
+      slots.capacity = 3;
+
+      ASSERT_EQ(0, slots.acquire());
+      ASSERT_EQ(1, slots.acquire());
+      ASSERT_EQ(2, slots.acquire());
+      ASSERT_EQ(3, slots.size());
+      ASSERT_THROW(slots.acquire(), std::runtime_error);
+
+      slots.release(1, 0);
+      ASSERT_EQ(2, slots.size());
+      ASSERT_THROW(slots.release(1, 0), std::runtime_error);
+      ASSERT_EQ(2, slots.size());
+      ASSERT_THROW(slots.acquire(), std::runtime_error);
+
+      slots.recycle(1, 2);
+      ASSERT_THROW(slots.acquire(), std::runtime_error);
+      slots.recycle(2, 2);
+      ASSERT_EQ(1, slots.acquire());
+      ASSERT_EQ(3, slots.size());
+      ASSERT_THROW(slots.release(3, 2), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(BindlessTableTests, test2) {
+    try {
+      vk::PhysicalDeviceDescriptorIndexingFeatures requested = vk::PhysicalDeviceDescriptorIndexingFeatures()
+          .setDescriptorBindingPartiallyBound(true)
+          .setRuntimeDescriptorArray(true);
+      vk::PhysicalDeviceDescriptorIndexingFeatures supported = vk::PhysicalDeviceDescriptorIndexingFeatures()
+          .setDescriptorBindingPartiallyBound(true);
+
+      ASSERT_FALSE(PhysicalDevice::isSupported(requested, supported));
+
+      supported.setRuntimeDescriptorArray(true);
+      ASSERT_TRUE(PhysicalDevice::isSupported(requested, supported));
+
+      PhysicalDevice physicalDevice = {};
+      physicalDevice.descriptorIndexingFeatures = requested;
+      physicalDevice.dynamicRenderingFeatures = vk::PhysicalDeviceDynamicRenderingFeaturesKHR().setDynamicRendering(true);
+
+      ASSERT_EQ(&physicalDevice.descriptorIndexingFeatures.value(), physicalDevice.featuresChain());
+      ASSERT_EQ(&physicalDevice.dynamicRenderingFeatures.value(), physicalDevice.descriptorIndexingFeatures.value().pNext);
+      ASSERT_EQ(nullptr, physicalDevice.dynamicRenderingFeatures.value().pNext);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(BindlessTableTests, test3) {
+    try {
+      TestContext& context = TestContext::get();
+
+      vk::PhysicalDeviceDescriptorIndexingFeatures requested = vk::PhysicalDeviceDescriptorIndexingFeatures()
+          .setDescriptorBindingPartiallyBound(true)
+          .setDescriptorBindingSampledImageUpdateAfterBind(true)
+          .setDescriptorBindingStorageBufferUpdateAfterBind(true)
+          .setDescriptorBindingUpdateUnusedWhilePending(true);
+      auto chain = context.physicalDevice.reference().getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures>();
+      if (!PhysicalDevice::isSupported(requested, chain.get<vk::PhysicalDeviceDescriptorIndexingFeatures>())) {
+        GTEST_SKIP() << "descriptor indexing is not supported";
+      }
+
+      PhysicalDevice physicalDevice = PhysicalDevice::builder()
+          .setInstance(context.instance.value)
+          .setDescriptorIndexingFeatures(requested)
+          .addQueueType(vk::QueueFlagBits::eGraphics)
+          .setQueuePriority(1.0f)
+      .build();
+
+      Device device = Device::builder()
+          .setPhysicalDevice(physicalDevice)
+          .setCreateInfo(
+              vk::DeviceCreateInfo()
+                  .setQueueCreateInfos(physicalDevice.uniqueQueueCreateInfos)
+                  .setPEnabledFeatures(&physicalDevice.features)
+                  .setPEnabledExtensionNames(physicalDevice.enabledExtensionNames)
+                  .setPEnabledLayerNames(context.instance.enabledLayerNames)
+          )
+      .build();
+      ASSERT_EQ(&physicalDevice.descriptorIndexingFeatures.value(), device.createInfo.pNext);
+      ASSERT_TRUE(device.isExtensionEnabled(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME));
+
+      Queue queue = Queue::builder()
+          .setDevice(device.value)
+          .setFamilyIndex(physicalDevice.graphicsQueueCreateInfos.front().queueFamilyIndex)
+      .build();
+
+      CommandPool commandPool = CommandPool::builder()
+          .setDevice(device.value)
+          .setCreateInfo(
+              vk::CommandPoolCreateInfo()
+                  .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer)
+                  .setQueueFamilyIndex(queue.familyIndex)
+          )
+      .build();
+
+      BindlessTable bindlessTable = BindlessTable::builder()
+          .setDevice(device.value)
+          .setImageCapacity(16)
+          .setSamplerCapacity(4)
+          .setBufferCapacity(16)
+          .setFrameCount(2)
+      .build();
+
+      Image image = Image::builder()
+          .setPhysicalDevice(physicalDevice.value)
+          .setDevice(device.value)
+          .setCreateInfo(
+              vk::ImageCreateInfo()
+                  .setImageType(vk::ImageType::e2D)
+                  .setFormat(vk::Format::eR8G8B8A8Unorm)
+                  .setExtent(vk::Extent3D().setWidth(4).setHeight(4).setDepth(1))
+                  .setMipLevels(1)
+                  .setArrayLayers(1)
+                  .setSamples(vk::SampleCountFlagBits::e1)
+                  .setTiling(vk::ImageTiling::eOptimal)
+                  .setUsage(vk::ImageUsageFlagBits::eSampled)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+                  .setInitialLayout(vk::ImageLayout::eUndefined)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+      .build();
+
+      ImageView imageView = ImageView::builder()
+          .setDevice(device.value)
+          .setCreateInfo(
+              vk::ImageViewCreateInfo()
+                  .setImage(*image.reference())
+                  .setViewType(vk::ImageViewType::e2D)
+                  .setFormat(vk::Format::eR8G8B8A8Unorm)
+                  .setSubresourceRange(
+                      vk::ImageSubresourceRange()
+                          .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                          .setBaseMipLevel(0)
+                          .setLevelCount(1)
+                          .setBaseArrayLayer(0)
+                          .setLayerCount(1)
+                  )
+          )
+      .build();
+
+      Sampler sampler = Sampler::builder()
+          .setDevice(device.value)
+          .setCreateInfo(vk::SamplerCreateInfo())
+      .build();
+
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(physicalDevice.value)
+          .setDevice(device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(256)
+                  .setUsage(vk::BufferUsageFlagBits::eStorageBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+      .build();
+
+      ASSERT_EQ(0, bindlessTable.addImageView(*imageView.reference()));
+      ASSERT_EQ(0, bindlessTable.addSampler(*sampler.reference()));
+      ASSERT_EQ(0, bindlessTable.addBuffer(*buffer.reference()));
+      ASSERT_EQ(1, bindlessTable.addBuffer(*buffer.reference()));
+
+      vk::DescriptorSetLayout setLayout = *bindlessTable.layout.reference();
+      vk::raii::PipelineLayout pipelineLayout(device.reference(), vk::PipelineLayoutCreateInfo().setSetLayouts(setLayout));
+
+      CommandBuffer commandBuffer = CommandBuffer::builder()
+          .setDevice(device.value)
+          .setCreateInfo(
+              vk::CommandBufferAllocateInfo()
+                  .setCommandPool(*commandPool.reference())
+                  .setCommandBufferCount(1)
+                  .setLevel(vk::CommandBufferLevel::ePrimary)
+          )
+      .build();
+      commandBuffer.reference().begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+      bindlessTable.bind(commandBuffer.reference(), vk::PipelineBindPoint::eGraphics, *pipelineLayout);
+      commandBuffer.reference().end();
+      queue.reference().submit({vk::SubmitInfo().setCommandBuffers(*commandBuffer.reference())});
+      queue.reference().waitIdle();
+
+      ASSERT_EQ(1, bindlessTable.images.size());
+      ASSERT_EQ(1, bindlessTable.samplers.size());
+      ASSERT_EQ(2, bindlessTable.buffers.size());
+
+      bindlessTable.removeBuffer(0);
+      ASSERT_EQ(1, bindlessTable.buffers.size());
+      ASSERT_EQ(2, bindlessTable.addBuffer(*buffer.reference()));
+      bindlessTable.beginFrame();
+      ASSERT_EQ(3, bindlessTable.addBuffer(*buffer.reference()));
+      bindlessTable.beginFrame();
+      ASSERT_EQ(0, bindlessTable.addBuffer(*buffer.reference()));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class CommandBufferTests : public testing::Test {
+  };
+
+  TEST_F(CommandBufferTests, test1) {
+    try {
+      TestContext& context = TestContext::get();
+
+      std::vector<CommandBuffer> commandBuffers = CommandBuffer::builder()
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::CommandBufferAllocateInfo()
+                  .setCommandPool(*context.graphicsCommandPool.reference())
+                  .setLevel(vk::CommandBufferLevel::ePrimary)
+          )
+      .buildAll(3);
+
+      ASSERT_EQ(3, commandBuffers.size());
+      for (CommandBuffer& commandBuffer : commandBuffers) {
+        ASSERT_EQ(1, commandBuffer.createInfo.commandBufferCount);
+        ASSERT_TRUE(commandBuffer.value);
+      }
+      ASSERT_NE(*commandBuffers[0].reference(), *commandBuffers[1].reference());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorAllocatorTests : public testing::Test {
+  };
+
+  TEST_F(DescriptorAllocatorTests, test1) {
+    try {
+      std::vector<vk::DescriptorPoolSize> poolSizes = {
+          vk::DescriptorPoolSize().setType(vk::DescriptorType::eUniformBuffer).setDescriptorCount(10),
+          vk::DescriptorPoolSize().setType(vk::DescriptorType::eCombinedImageSampler).setDescriptorCount(1)
+      };
+
+      std::vector<vk::DescriptorPoolSize> scaled = DescriptorAllocator::scale(poolSizes, 1.5);
+      ASSERT_EQ(2, scaled.size());
+      ASSERT_EQ(vk::DescriptorType::eUniformBuffer, scaled[0].type);
+      ASSERT_EQ(15, scaled[0].descriptorCount);
+      ASSERT_EQ(2, scaled[1].descriptorCount);
+      ASSERT_EQ(1, DescriptorAllocator::scale(poolSizes, 0.01)[1].descriptorCount);
+
+      DescriptorAllocator descriptorAllocator = DescriptorAllocator::builder()
+          .setPoolSizes(poolSizes)
+          .setCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(16))
+          .setGrowthFactor(2.0)
+          .setMaxSetsLimit(8)
+          .setFrameCount(3)
+      .build();
+
+      ASSERT_EQ(3, descriptorAllocator.frames.size());
+      ASSERT_EQ(16, descriptorAllocator.nextMaxSets);
+      ASSERT_EQ(16, descriptorAllocator.maxSetsLimit);
+      ASSERT_EQ(2.0, descriptorAllocator.growthFactor);
+      ASSERT_EQ(0, descriptorAllocator.poolCount());
+      ASSERT_TRUE(descriptorAllocator.allocate(std::vector<vk::DescriptorSetLayout>()).empty());
+
+      descriptorAllocator.beginFrame(4);
+      ASSERT_EQ(1, descriptorAllocator.currentFrame);
+      ASSERT_EQ(1, descriptorAllocator.frames[1].resetCount);
+
+      ASSERT_THROW(DescriptorAllocator::builder().build(), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorAllocatorTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+
+      DescriptorSetLayout descriptorSetLayout = DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+          )
+      .build();
+      vk::DescriptorSetLayout setLayout = *descriptorSetLayout.reference();
+
+      DescriptorAllocator descriptorAllocator = DescriptorAllocator::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eUniformBuffer).setDescriptorCount(2))
+          .setCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(2))
+          .setGrowthFactor(2.0)
+          .setMaxSetsLimit(64)
+          .setFrameCount(2)
+      .build();
+
+      descriptorAllocator.beginFrame(0);
+      ASSERT_EQ(2, descriptorAllocator.allocate(std::vector<vk::DescriptorSetLayout>(2, setLayout)).size());
+      ASSERT_EQ(1, descriptorAllocator.poolCreateCount);
+      ASSERT_TRUE(descriptorAllocator.allocate(setLayout));
+      ASSERT_EQ(2, descriptorAllocator.poolCreateCount);
+      ASSERT_EQ(2, descriptorAllocator.frames[0].pools.size());
+      ASSERT_EQ(3, descriptorAllocator.frames[0].setCount);
+      ASSERT_EQ(8, descriptorAllocator.nextMaxSets);
+
+      descriptorAllocator.beginFrame(1);
+      ASSERT_EQ(3, descriptorAllocator.allocate(std::vector<vk::DescriptorSetLayout>(3, setLayout)).size());
+      ASSERT_EQ(3, descriptorAllocator.poolCreateCount);
+
+      descriptorAllocator.beginFrame(0);
+      ASSERT_EQ(2, descriptorAllocator.freePools.size());
+      ASSERT_TRUE(descriptorAllocator.allocate(setLayout));
+      ASSERT_EQ(3, descriptorAllocator.poolCreateCount);
+      ASSERT_EQ(1, descriptorAllocator.freePools.size());
+
+      ASSERT_EQ(4, descriptorAllocator.allocate(std::vector<vk::DescriptorSetLayout>(4, setLayout)).size());
+      ASSERT_EQ(4, descriptorAllocator.poolCreateCount);
+      ASSERT_EQ(1, descriptorAllocator.freePools.size());
+      ASSERT_EQ(4, descriptorAllocator.poolCount());
+      ASSERT_EQ(5, descriptorAllocator.frames[0].setCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorSetCacheTests : public testing::Test {
+  };
+
+  TEST_F(DescriptorSetCacheTests, test1) {
+    try {
+      std::vector<WriteDescriptorSet> writes1 = {
+          WriteDescriptorSet()
+              .setDstBinding(0)
+              .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+              .setDescriptorCount(1)
+              .setBufferInfo({vk::DescriptorBufferInfo().setOffset(0).setRange(64)})
+      };
+      std::vector<WriteDescriptorSet> writes2 = writes1;
+      writes2[0].setDstSet(vk::DescriptorSet());
+
+      ASSERT_TRUE(DescriptorSetCache::equals(writes1, writes2));
+      ASSERT_EQ(DescriptorSetCache::hash({}, writes1), DescriptorSetCache::hash({}, writes2));
+
+      writes2[0].setBufferInfo({vk::DescriptorBufferInfo().setOffset(64).setRange(64)});
+      ASSERT_FALSE(DescriptorSetCache::equals(writes1, writes2));
+      ASSERT_NE(DescriptorSetCache::hash({}, writes1), DescriptorSetCache::hash({}, writes2));
+      ASSERT_FALSE(DescriptorSetCache::equals(writes1, {}));
+
+      DescriptorSetCache descriptorSetCache = DescriptorSetCache::builder()
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eUniformBuffer).setDescriptorCount(16))
+          .setMaxUnusedFrames(3)
+      .build();
+
+      ASSERT_EQ(3, descriptorSetCache.maxUnusedFrames);
+      ASSERT_EQ(256, descriptorSetCache.poolCreateInfo.maxSets);
+      ASSERT_EQ(vk::DescriptorPoolCreateFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet), descriptorSetCache.poolCreateInfo.flags);
+      ASSERT_EQ(0.0, descriptorSetCache.hitRate());
+
+      descriptorSetCache.beginFrame();
+      ASSERT_EQ(1, descriptorSetCache.frame);
+      ASSERT_EQ(0, descriptorSetCache.size());
+
+      ASSERT_THROW(DescriptorSetCache::builder().build(), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorSetCacheTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+
+      DescriptorSetLayout descriptorSetLayout = DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+          )
+      .build();
+      vk::DescriptorSetLayout setLayout = *descriptorSetLayout.reference();
+
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(256)
+                  .setUsage(vk::BufferUsageFlagBits::eUniformBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+      .build();
+
+      std::vector<WriteDescriptorSet> writes1 = {
+          WriteDescriptorSet()
+              .setDstBinding(0)
+              .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+              .setDescriptorCount(1)
+              .setBufferInfo({vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(0).setRange(64)})
+      };
+      std::vector<WriteDescriptorSet> writes2 = writes1;
+      writes2[0].setBufferInfo({vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(0).setRange(128)});
+
+      DescriptorSetCache descriptorSetCache = DescriptorSetCache::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eUniformBuffer).setDescriptorCount(16))
+          .setPoolCreateInfo(vk::DescriptorPoolCreateInfo().setMaxSets(16))
+          .setMaxUnusedFrames(1)
+      .build();
+
+      vk::DescriptorSet descriptorSet1 = descriptorSetCache.get(setLayout, writes1);
+      ASSERT_TRUE(descriptorSet1);
+      ASSERT_EQ(descriptorSet1, descriptorSetCache.get(setLayout, writes1));
+      vk::DescriptorSet descriptorSet2 = descriptorSetCache.get(setLayout, writes2);
+      ASSERT_NE(descriptorSet1, descriptorSet2);
+      ASSERT_EQ(1, descriptorSetCache.hitCount);
+      ASSERT_EQ(2, descriptorSetCache.missCount);
+      ASSERT_EQ(2, descriptorSetCache.size());
+      ASSERT_EQ(1, descriptorSetCache.pools.size());
+
+      descriptorSetCache.beginFrame();
+      ASSERT_EQ(descriptorSet1, descriptorSetCache.get(setLayout, writes1));
+      ASSERT_EQ(2, descriptorSetCache.size());
+      ASSERT_EQ(0, descriptorSetCache.evictCount);
+
+      descriptorSetCache.beginFrame();
+      ASSERT_EQ(1, descriptorSetCache.size());
+      ASSERT_EQ(1, descriptorSetCache.evictCount);
+
+      descriptorSetCache.get(setLayout, writes2);
+      ASSERT_EQ(2, descriptorSetCache.hitCount);
+      ASSERT_EQ(3, descriptorSetCache.missCount);
+      ASSERT_EQ(0.4, descriptorSetCache.hitRate());
+      ASSERT_EQ(2, descriptorSetCache.size());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
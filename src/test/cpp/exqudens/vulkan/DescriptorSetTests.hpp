@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorSetTests : public testing::Test {
+  };
+
+  TEST_F(DescriptorSetTests, test1) {
+    try {
+      TestContext& context = TestContext::get();
+
+      DescriptorSetLayout descriptorSetLayout = DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eVertex)
+          )
+      .build();
+      DescriptorPool descriptorPool = DescriptorPool::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eUniformBuffer).setDescriptorCount(3))
+          .setCreateInfo(
+              vk::DescriptorPoolCreateInfo()
+                  .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+                  .setMaxSets(3)
+          )
+      .build();
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(3 * 256)
+                  .setUsage(vk::BufferUsageFlagBits::eUniformBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eDeviceLocal)
+      .build();
+
+      std::vector<DescriptorSet> descriptorSets = DescriptorSet::builder()
+          .setDevice(context.device.value)
+          .addSetLayout(*descriptorSetLayout.reference())
+          .setCreateInfo(vk::DescriptorSetAllocateInfo().setDescriptorPool(*descriptorPool.reference()))
+          .setWritesFunction([&buffer](const size_t& i) {
+            return std::vector<WriteDescriptorSet> {
+                WriteDescriptorSet()
+                    .setDstBinding(0)
+                    .setDstArrayElement(0)
+                    .setDescriptorCount(1)
+                    .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                    .setBufferInfo({vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(i * 256).setRange(64)})
+            };
+          })
+      .buildAll(3);
+
+      ASSERT_EQ(3, descriptorSets.size());
+      for (size_t i = 0; i < descriptorSets.size(); i++) {
+        DescriptorSet& descriptorSet = descriptorSets[i];
+        ASSERT_EQ(1, descriptorSet.createInfo.descriptorSetCount);
+        ASSERT_EQ(descriptorSet.setLayouts.data(), descriptorSet.createInfo.pSetLayouts);
+        ASSERT_EQ(*descriptorSetLayout.reference(), descriptorSet.createInfo.pSetLayouts[0]);
+        ASSERT_EQ(1, descriptorSet.writes.size());
+        ASSERT_EQ(*descriptorSet.reference(), descriptorSet.writes.front().dstSet);
+        ASSERT_EQ(i * 256, descriptorSet.writes.front().bufferInfo.front().offset);
+        ASSERT_EQ(descriptorSet.writes.front().bufferInfo.data(), descriptorSet.writes.front().pBufferInfo);
+      }
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
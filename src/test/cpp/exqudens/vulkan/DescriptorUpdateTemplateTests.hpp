@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorUpdateTemplateTests : public testing::Test {
+
+    protected:
+
+      struct Data {
+
+        vk::DescriptorBufferInfo uniform;
+        vk::DescriptorImageInfo textures[2];
+        vk::BufferView texel;
+
+      };
+
+      struct Constants {
+        uint32_t count = 0;
+        uint32_t factor = 0;
+      };
+
+  };
+
+  TEST_F(DescriptorUpdateTemplateTests, test1) {
+    try {
+      std::vector<vk::DescriptorUpdateTemplateEntry> entries = DescriptorUpdateTemplate::layoutEntries({
+          vk::DescriptorSetLayoutBinding()
+              .setBinding(3)
+              .setDescriptorType(vk::DescriptorType::eUniformTexelBuffer)
+              .setDescriptorCount(1),
+          vk::DescriptorSetLayoutBinding()
+              .setBinding(1)
+              .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+              .setDescriptorCount(2),
+          vk::DescriptorSetLayoutBinding()
+              .setBinding(2)
+              .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+              .setDescriptorCount(0),
+          vk::DescriptorSetLayoutBinding()
+              .setBinding(0)
+              .setDescriptorType(vk::DescriptorType::eUniformBufferDynamic)
+              .setDescriptorCount(1)
+      });
+
+      ASSERT_EQ(3, entries.size());
+      ASSERT_EQ(0, entries[0].dstBinding);
+      ASSERT_EQ(offsetof(Data, uniform), entries[0].offset);
+      ASSERT_EQ(sizeof(vk::DescriptorBufferInfo), entries[0].stride);
+      ASSERT_EQ(1, entries[1].dstBinding);
+      ASSERT_EQ(2, entries[1].descriptorCount);
+      ASSERT_EQ(offsetof(Data, textures), entries[1].offset);
+      ASSERT_EQ(sizeof(vk::DescriptorImageInfo), entries[1].stride);
+      ASSERT_EQ(3, entries[2].dstBinding);
+      ASSERT_EQ(offsetof(Data, texel), entries[2].offset);
+      ASSERT_EQ(sizeof(Data), DescriptorUpdateTemplate::dataSize(entries));
+
+      ASSERT_EQ(16, DescriptorUpdateTemplate::layoutEntries({
+          vk::DescriptorSetLayoutBinding()
+              .setBinding(0)
+              .setDescriptorType(vk::DescriptorType::eSampledImage)
+              .setDescriptorCount(1)
+      }, 16).front().offset);
+      ASSERT_THROW(DescriptorUpdateTemplate::stride(vk::DescriptorType::eAccelerationStructureKHR), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorUpdateTemplateTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+      const uint32_t count = 100;
+      const vk::DeviceSize size = count * sizeof(uint32_t);
+
+      DescriptorSetLayout descriptorSetLayout = DescriptorSetLayout::builder()
+          .setDevice(context.device.value)
+          .addBinding(
+              vk::DescriptorSetLayoutBinding()
+                  .setBinding(0)
+                  .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                  .setDescriptorCount(1)
+                  .setStageFlags(vk::ShaderStageFlagBits::eCompute)
+          )
+      .build();
+
+      DescriptorUpdateTemplate descriptorUpdateTemplate = DescriptorUpdateTemplate::builder()
+          .setDevice(context.device.value)
+          .setDescriptorSetLayout(descriptorSetLayout)
+      .build();
+      ASSERT_EQ(1, descriptorUpdateTemplate.entries.size());
+      ASSERT_EQ(sizeof(vk::DescriptorBufferInfo), descriptorUpdateTemplate.size);
+
+      Pipeline pipeline = Pipeline::builder()
+          .setDevice(context.device.value)
+          .setReflectLayouts(true)
+          .addSetLayout(*descriptorSetLayout.reference())
+          .setComputeCreateInfo(vk::ComputePipelineCreateInfo())
+          .addPath(std::filesystem::path().append("resources").append("shader").append("shader-5.comp.spv").make_preferred().string())
+      .build();
+
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(size)
+                  .setUsage(vk::BufferUsageFlagBits::eStorageBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+      .build();
+      auto* values = static_cast<uint32_t*>(buffer.mapMemory(0, size));
+      std::memset(values, 0, size);
+
+      DescriptorPool descriptorPool = DescriptorPool::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eStorageBuffer).setDescriptorCount(1))
+          .setCreateInfo(
+              vk::DescriptorPoolCreateInfo()
+                  .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+                  .setMaxSets(1)
+          )
+      .build();
+      DescriptorSet descriptorSet = DescriptorSet::builder()
+          .setDevice(context.device.value)
+          .addSetLayout(*descriptorSetLayout.reference())
+          .setCreateInfo(vk::DescriptorSetAllocateInfo().setDescriptorPool(*descriptorPool.reference()))
+      .build();
+
+      descriptorUpdateTemplate.update(
+          *descriptorSet.reference(),
+          vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(0).setRange(size)
+      );
+      ASSERT_THROW(descriptorUpdateTemplate.update(*descriptorSet.reference(), uint32_t(0)), std::runtime_error);
+
+      Constants constants = {count, 5};
+      context.submit([&pipeline, &descriptorSet, &constants, &count](vk::raii::CommandBuffer& commandBuffer) {
+        pipeline.dispatch(commandBuffer, {*descriptorSet.reference()}, constants, Utility::groupCount(count, 64));
+      });
+
+      for (uint32_t i = 0; i < count; i++) {
+        ASSERT_EQ(i * constants.factor, values[i]);
+      }
+      buffer.unmapMemory();
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
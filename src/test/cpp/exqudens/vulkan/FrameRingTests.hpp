@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <limits>
+#include <chrono>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class FrameRingTests : public testing::Test {
+  };
+
+  TEST_F(FrameRingTests, test1) {
+    try {
+      TestContext& context = TestContext::get();
+
+      OffscreenTarget offscreenTarget = OffscreenTarget::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setQueue(context.graphicsQueue.value)
+          .setCommandPool(*context.graphicsCommandPool.reference())
+          .setFormat(vk::Format::eR8G8B8A8Unorm)
+          .setExtent(vk::Extent2D().setWidth(4).setHeight(4))
+          .setImageCount(2)
+          .setUsage(vk::ImageUsageFlagBits::eTransferDst)
+          .setLayout(vk::ImageLayout::eTransferDstOptimal)
+      .build();
+
+      FrameRing<2> frameRing = FrameRing<2>::builder()
+          .setDevice(context.device.value)
+          .setCommandPool(*context.graphicsCommandPool.reference())
+      .build();
+
+      std::shared_ptr<int> object = std::make_shared<int>(1);
+      std::weak_ptr<int> retired = object;
+
+      for (size_t i = 0; i < 4; i++) {
+        ASSERT_EQ(vk::Result::eSuccess, frameRing.begin(offscreenTarget));
+        if (i == 0) {
+          frameRing.retire(object);
+          object.reset();
+        }
+        ASSERT_EQ(i >= 2, retired.expired());
+        ASSERT_GT(frameRing.current().waitTime, std::chrono::nanoseconds::zero());
+
+        vk::Image image = *offscreenTarget.images[frameRing.imageIndex].reference();
+        vk::ImageSubresourceRange subresourceRange = vk::ImageSubresourceRange()
+            .setAspectMask(vk::ImageAspectFlagBits::eColor)
+            .setBaseMipLevel(0)
+            .setLevelCount(1)
+            .setBaseArrayLayer(0)
+            .setLayerCount(1);
+        vk::raii::CommandBuffer& commandBuffer = frameRing.commandBufferReference();
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTopOfPipe,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::DependencyFlags(0),
+            {},
+            {},
+            {
+                vk::ImageMemoryBarrier()
+                    .setSrcAccessMask(vk::AccessFlags())
+                    .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+                    .setOldLayout(vk::ImageLayout::eUndefined)
+                    .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                    .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setImage(image)
+                    .setSubresourceRange(subresourceRange)
+            }
+        );
+        commandBuffer.clearColorImage(
+            image,
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::ClearColorValue().setFloat32({0.0f, 1.0f, 0.0f, 1.0f}),
+            {subresourceRange}
+        );
+
+        frameRing.submit(context.graphicsQueue.reference(), vk::PipelineStageFlagBits::eTransfer);
+        ASSERT_EQ(i + 1, frameRing.frameNumber);
+        ASSERT_EQ(vk::Result::eSuccess, frameRing.present(offscreenTarget));
+        ASSERT_EQ((i + 1) % 2, frameRing.currentFrame);
+      }
+
+      context.device.reference().waitIdle();
+      ASSERT_TRUE(frameRing.retired.empty());
+      ASSERT_GT(frameRing.averageWaitTime(), std::chrono::nanoseconds::zero());
+      ASSERT_EQ(4, offscreenTarget.presentedCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/GpuProfiler.hpp"
+
+namespace exqudens::vulkan {
+
+  class GpuProfilerTests : public testing::Test {
+  };
+
+  TEST_F(GpuProfilerTests, test1) {
+    try {
+      std::vector<double> values;
+      for (int i = 100; i > 0; i--) {
+        values.emplace_back(static_cast<double>(i));
+      }
+
+      GpuProfiler::Stats stats = GpuProfiler::aggregate(values);
+      ASSERT_EQ(100, stats.count);
+      ASSERT_DOUBLE_EQ(1.0, stats.min);
+      ASSERT_DOUBLE_EQ(50.5, stats.avg);
+      ASSERT_DOUBLE_EQ(99.0, stats.p99);
+
+      stats = GpuProfiler::aggregate({2.0});
+      ASSERT_EQ(1, stats.count);
+      ASSERT_DOUBLE_EQ(2.0, stats.p99);
+
+      stats = GpuProfiler::aggregate({});
+      ASSERT_EQ(0, stats.count);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(GpuProfilerTests, test2) {
+    try {
+      GpuProfiler profiler = {};
+      profiler.sampleCount = 3;
+      profiler.addSample("a", 1.0);
+      profiler.addSample("a", 2.0);
+      profiler.addSample("a", 3.0);
+      profiler.addSample("a", 10.0);
+
+      ASSERT_EQ(4, profiler.samples["a"].count);
+      GpuProfiler::Stats stats = profiler.stats("a");
+      ASSERT_EQ(3, stats.count);
+      ASSERT_DOUBLE_EQ(2.0, stats.min);
+      ASSERT_DOUBLE_EQ(10.0, stats.p99);
+
+      ASSERT_EQ(0, profiler.stats("b").count);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/Vertex.hpp"
+#include "exqudens/vulkan/GraphicsPipelineCreateInfo.hpp"
+
+namespace exqudens::vulkan {
+
+  class GraphicsPipelineCreateInfoTests : public testing::Test {
+  };
+
+  TEST_F(GraphicsPipelineCreateInfoTests, test1) {
+    try {
+      GraphicsPipelineCreateInfo createInfo = GraphicsPipelineCreateInfo()
+          .setViewportState(
+              PipelineViewportStateCreateInfo()
+                  .setViewports({vk::Viewport().setWidth(800).setHeight(600)})
+                  .setScissors({vk::Rect2D().setExtent({800, 600})})
+          )
+          .setDynamicViewport()
+          .setExtendedDynamicState()
+          .addDynamicState(vk::DynamicState::eViewport);
+
+      ASSERT_EQ(2 + GraphicsPipelineCreateInfo::EXTENDED_DYNAMIC_STATES.size(), createInfo.dynamicStates.size());
+      ASSERT_EQ(vk::DynamicState::eViewport, createInfo.dynamicStates[0]);
+      ASSERT_EQ(vk::DynamicState::eScissor, createInfo.dynamicStates[1]);
+      ASSERT_EQ(&createInfo.dynamicState.value(), createInfo.pDynamicState);
+      ASSERT_EQ(createInfo.dynamicStates.size(), createInfo.pDynamicState->dynamicStateCount);
+      ASSERT_EQ(createInfo.dynamicStates.data(), createInfo.pDynamicState->pDynamicStates);
+      ASSERT_EQ(1, createInfo.pViewportState->viewportCount);
+      ASSERT_EQ(1, createInfo.pViewportState->scissorCount);
+      ASSERT_EQ(nullptr, createInfo.pViewportState->pViewports);
+      ASSERT_EQ(nullptr, createInfo.pViewportState->pScissors);
+      ASSERT_FALSE(createInfo.renderingCreateInfo);
+      ASSERT_EQ(nullptr, createInfo.pNext);
+
+      GraphicsPipelineCreateInfo copy = createInfo;
+      createInfo = GraphicsPipelineCreateInfo();
+
+      ASSERT_EQ(copy.dynamicStates.data(), copy.pDynamicState->pDynamicStates);
+      ASSERT_EQ(nullptr, copy.pViewportState->pViewports);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(GraphicsPipelineCreateInfoTests, test2) {
+    try {
+      GraphicsPipelineCreateInfo createInfo = GraphicsPipelineCreateInfo()
+          .setColorAttachmentFormats({vk::Format::eB8G8R8A8Srgb})
+          .setDepthAttachmentFormat(vk::Format::eD32Sfloat);
+
+      ASSERT_TRUE(createInfo.renderingCreateInfo);
+      ASSERT_EQ(&createInfo.renderingCreateInfo.value(), createInfo.pNext);
+      ASSERT_FALSE(createInfo.renderPass);
+      ASSERT_EQ(1, createInfo.renderingCreateInfo.value().colorAttachmentCount);
+      ASSERT_EQ(createInfo.colorAttachmentFormats.data(), createInfo.renderingCreateInfo.value().pColorAttachmentFormats);
+      ASSERT_EQ(vk::Format::eD32Sfloat, createInfo.renderingCreateInfo.value().depthAttachmentFormat);
+
+      GraphicsPipelineCreateInfo copy = createInfo;
+      createInfo.setColorAttachmentFormats({vk::Format::eR8G8B8A8Unorm, vk::Format::eR16G16B16A16Sfloat});
+
+      ASSERT_EQ(&copy.renderingCreateInfo.value(), copy.pNext);
+      ASSERT_EQ(copy.colorAttachmentFormats.data(), copy.renderingCreateInfo.value().pColorAttachmentFormats);
+      ASSERT_EQ(vk::Format::eB8G8R8A8Srgb, copy.renderingCreateInfo.value().pColorAttachmentFormats[0]);
+      ASSERT_EQ(2, createInfo.renderingCreateInfo.value().colorAttachmentCount);
+
+      createInfo.setRenderingCreateInfo(createInfo.renderingCreateInfo.value());
+      ASSERT_EQ(nullptr, createInfo.renderingCreateInfo.value().pNext);
+      ASSERT_EQ(2, createInfo.colorAttachmentFormats.size());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(GraphicsPipelineCreateInfoTests, test3) {
+    try {
+      std::vector<vk::PipelineShaderStageCreateInfo> stages = {
+          vk::PipelineShaderStageCreateInfo().setStage(vk::ShaderStageFlagBits::eVertex).setPName("main"),
+          vk::PipelineShaderStageCreateInfo().setStage(vk::ShaderStageFlagBits::eFragment).setPName("main")
+      };
+      GraphicsPipelineCreateInfo* original = new GraphicsPipelineCreateInfo();
+      original->setStages(stages);
+      original->setVertexInputState(
+          PipelineVertexInputStateCreateInfo()
+              .setVertexBindingDescriptions({Vertex::getBindingDescription()})
+              .setVertexAttributeDescriptions(Vertex::getAttributeDescriptions())
+      );
+      original->setViewportState(
+          PipelineViewportStateCreateInfo()
+              .setViewportCount(1)
+              .setScissorCount(1)
+      );
+      original->setColorBlendState(
+          PipelineColorBlendStateCreateInfo()
+              .setAttachments({vk::PipelineColorBlendAttachmentState()})
+      );
+
+      GraphicsPipelineCreateInfo copy = *original;
+      delete original;
+
+      ASSERT_EQ(2, copy.stageCount);
+      ASSERT_EQ(copy.stages.data(), copy.pStages);
+      ASSERT_EQ(&copy.vertexInputState.value(), copy.pVertexInputState);
+      ASSERT_EQ(copy.vertexInputState.value().vertexAttributeDescriptions.data(), copy.pVertexInputState->pVertexAttributeDescriptions);
+      ASSERT_EQ(Vertex::getAttributeDescriptions().size(), copy.pVertexInputState->vertexAttributeDescriptionCount);
+      ASSERT_EQ(&copy.viewportState.value(), copy.pViewportState);
+      ASSERT_EQ(1, copy.pViewportState->viewportCount);
+      ASSERT_EQ(nullptr, copy.pViewportState->pViewports);
+      ASSERT_EQ(&copy.colorBlendState.value(), copy.pColorBlendState);
+      ASSERT_EQ(copy.colorBlendState.value().attachments.data(), copy.pColorBlendState->pAttachments);
+      ASSERT_EQ(nullptr, copy.pRasterizationState);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
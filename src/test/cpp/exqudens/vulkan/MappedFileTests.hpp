@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/MappedFile.hpp"
+
+namespace exqudens::vulkan {
+
+  class MappedFileTests : public testing::Test {
+  };
+
+  TEST_F(MappedFileTests, test1) {
+    try {
+      std::string path = (std::filesystem::temp_directory_path() / "exqudens-vulkan-mapped-file-tests.bin").string();
+      std::vector<uint32_t> expected = {0x07230203, 0x00010000, 0, 1, 0};
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      out.write(reinterpret_cast<const char*>(expected.data()), static_cast<std::streamsize>(expected.size() * sizeof(uint32_t)));
+      out.close();
+
+      MappedFile file = MappedFile::builder()
+          .setPath(path)
+          .setPrefetch(true)
+      .build();
+
+      ASSERT_EQ(expected.size() * sizeof(uint32_t), file.size);
+      ASSERT_EQ(file.size, file.bytes().size());
+      ASSERT_EQ(expected.size(), file.words().size());
+      ASSERT_TRUE(std::equal(expected.begin(), expected.end(), file.words().begin()));
+
+      MappedFile copy = file;
+      file = {};
+      ASSERT_EQ(expected[0], copy.words()[0]);
+
+      std::ofstream(path, std::ios::binary | std::ios::trunc).close();
+      MappedFile empty = MappedFile::builder().setPath(path).build();
+      ASSERT_EQ(0, empty.size);
+      ASSERT_TRUE(empty.bytes().empty());
+
+      std::filesystem::remove(path);
+      ASSERT_THROW(MappedFile::builder().setPath(path).build(), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/MemoryAllocator.hpp"
+#include "exqudens/vulkan/Buffer.hpp"
+
+namespace exqudens::vulkan {
+
+  class MemoryAllocatorTests : public testing::Test {
+  };
+
+  TEST_F(MemoryAllocatorTests, test1) {
+    try {
+      std::map<vk::DeviceSize, MemoryBlock::Range> ranges = {};
+
+      std::optional<vk::DeviceSize> offset = MemoryBlock::findOffset(ranges, 1024, 100, 16, true, 1);
+      ASSERT_EQ(0, offset.value());
+      ranges[offset.value()] = MemoryBlock::Range {.size = 100, .linear = true};
+
+      offset = MemoryBlock::findOffset(ranges, 1024, 100, 16, true, 1);
+      ASSERT_EQ(112, offset.value());
+      ranges[offset.value()] = MemoryBlock::Range {.size = 100, .linear = true};
+
+      offset = MemoryBlock::findOffset(ranges, 1024, 1024, 16, true, 1);
+      ASSERT_FALSE(offset.has_value());
+
+      ranges.erase(0);
+      offset = MemoryBlock::findOffset(ranges, 1024, 64, 16, true, 1);
+      ASSERT_EQ(0, offset.value());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MemoryAllocatorTests, test2) {
+    try {
+      std::map<vk::DeviceSize, MemoryBlock::Range> ranges = {};
+      ranges[0] = MemoryBlock::Range {.size = 100, .linear = true};
+
+      std::optional<vk::DeviceSize> offset = MemoryBlock::findOffset(ranges, 4096, 100, 16, false, 1024);
+      ASSERT_EQ(1024, offset.value());
+      ranges[offset.value()] = MemoryBlock::Range {.size = 100, .linear = false};
+
+      offset = MemoryBlock::findOffset(ranges, 4096, 100, 16, false, 1024);
+      ASSERT_EQ(1136, offset.value());
+
+      ranges[2048] = MemoryBlock::Range {.size = 100, .linear = true};
+      offset = MemoryBlock::findOffset(ranges, 4096, 950, 16, false, 1024);
+      ASSERT_EQ(2048 + 1024, offset.value());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MemoryAllocatorTests, test3) {
+    try {
+      Buffer buffer = {};
+      buffer.allocation = std::make_shared<MemoryAllocation>();
+      buffer.allocation->block = std::make_shared<MemoryBlock>();
+      buffer.allocation->offset = 256;
+
+      ASSERT_THROW(buffer.data(), std::runtime_error);
+      ASSERT_THROW(buffer.mapMemory(), std::runtime_error);
+      ASSERT_THROW(buffer.unmapMemory(), std::runtime_error);
+
+      char bytes[512] = {};
+      buffer.allocation->block->data = bytes;
+      ASSERT_EQ(bytes + 256, buffer.data());
+
+      buffer.allocation->block.reset();
+      buffer.allocation.reset();
+      ASSERT_THROW(buffer.data(), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/MemoryTypeSelector.hpp"
+
+namespace exqudens::vulkan {
+
+  class MemoryTypeSelectorTests : public testing::Test {
+
+    protected:
+
+      vk::PhysicalDeviceMemoryProperties memoryProperties = {};
+
+      void SetUp() override {
+        memoryProperties.memoryHeapCount = 2;
+        memoryProperties.memoryHeaps[0] = vk::MemoryHeap().setSize(1024).setFlags(vk::MemoryHeapFlagBits::eDeviceLocal);
+        memoryProperties.memoryHeaps[1] = vk::MemoryHeap().setSize(4096);
+        memoryProperties.memoryTypeCount = 4;
+        memoryProperties.memoryTypes[0] = vk::MemoryType()
+            .setPropertyFlags(vk::MemoryPropertyFlagBits::eDeviceLocal)
+            .setHeapIndex(0);
+        memoryProperties.memoryTypes[1] = vk::MemoryType()
+            .setPropertyFlags(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+            .setHeapIndex(1);
+        memoryProperties.memoryTypes[2] = vk::MemoryType()
+            .setPropertyFlags(vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+            .setHeapIndex(0);
+        memoryProperties.memoryTypes[3] = vk::MemoryType()
+            .setPropertyFlags(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent | vk::MemoryPropertyFlagBits::eHostCached)
+            .setHeapIndex(1);
+      }
+
+  };
+
+  TEST_F(MemoryTypeSelectorTests, test1) {
+    try {
+      std::optional<uint32_t> result = MemoryTypeSelector::select(
+          memoryProperties,
+          {},
+          0b1111,
+          vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+          vk::MemoryPropertyFlagBits::eDeviceLocal,
+          {},
+          0
+      );
+      ASSERT_EQ(2, result.value());
+
+      result = MemoryTypeSelector::select(
+          memoryProperties,
+          {},
+          0b1111,
+          vk::MemoryPropertyFlagBits::eHostVisible,
+          vk::MemoryPropertyFlagBits::eHostCached | vk::MemoryPropertyFlagBits::eHostCoherent,
+          vk::MemoryPropertyFlagBits::eDeviceLocal,
+          0
+      );
+      ASSERT_EQ(3, result.value());
+
+      result = MemoryTypeSelector::select(memoryProperties, {}, 0b0010, vk::MemoryPropertyFlagBits::eHostVisible, {}, {}, 0);
+      ASSERT_EQ(1, result.value());
+
+      result = MemoryTypeSelector::select(memoryProperties, {}, 0b0010, vk::MemoryPropertyFlagBits::eDeviceLocal, {}, {}, 0);
+      ASSERT_FALSE(result.has_value());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MemoryTypeSelectorTests, test2) {
+    try {
+      std::vector<vk::DeviceSize> heapBudgets = {100, 1000};
+
+      std::optional<uint32_t> result = MemoryTypeSelector::select(
+          memoryProperties,
+          heapBudgets,
+          0b1111,
+          vk::MemoryPropertyFlagBits::eHostVisible,
+          vk::MemoryPropertyFlagBits::eDeviceLocal,
+          {},
+          500
+      );
+      ASSERT_EQ(1, result.value());
+
+      result = MemoryTypeSelector::select(memoryProperties, heapBudgets, 0b1111, vk::MemoryPropertyFlagBits::eDeviceLocal, {}, {}, 500);
+      ASSERT_FALSE(result.has_value());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MemoryTypeSelectorTests, test3) {
+    try {
+      vk::raii::PhysicalDevice physicalDevice = nullptr;
+      MemoryTypeSelector selector = {};
+      selector.memoryProperties = memoryProperties;
+
+      selector.heapBudgets = {1024, 4096};
+      auto function = selector.memoryTypeIndexFunction(vk::MemoryPropertyFlagBits::eDeviceLocal);
+      ASSERT_EQ(2, function(physicalDevice, 0b1111, vk::MemoryPropertyFlagBits::eHostVisible));
+
+      selector.heapBudgets = {0, 4096};
+      function = selector.memoryTypeIndexFunction(vk::MemoryPropertyFlagBits::eDeviceLocal);
+      ASSERT_EQ(1, function(physicalDevice, 0b1111, vk::MemoryPropertyFlagBits::eHostVisible));
+
+      function = selector.memoryTypeIndexFunction(vk::MemoryPropertyFlagBits::eHostCached, vk::MemoryPropertyFlagBits::eDeviceLocal);
+      ASSERT_EQ(3, function(physicalDevice, 0b1111, vk::MemoryPropertyFlagBits::eHostVisible));
+
+      selector.heapBudgets = {0, 0};
+      function = selector.memoryTypeIndexFunction(vk::MemoryPropertyFlagBits::eDeviceLocal);
+      ASSERT_EQ(2, function(physicalDevice, 0b1111, vk::MemoryPropertyFlagBits::eHostVisible));
+      ASSERT_THROW(function(physicalDevice, 0b0001, vk::MemoryPropertyFlagBits::eHostVisible), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MemoryTypeSelectorTests, test4) {
+    try {
+      TestContext& context = TestContext::get();
+
+      std::shared_ptr<MemoryTypeSelector> selector = MemoryTypeSelector::shared(context.physicalDevice.value);
+      ASSERT_TRUE(selector);
+      ASSERT_EQ(selector, MemoryTypeSelector::shared(context.physicalDevice.value));
+      ASSERT_EQ(context.physicalDevice.value->getMemoryProperties(), selector->memoryProperties);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/Messenger.hpp"
+
+namespace exqudens::vulkan {
+
+  class MessengerTests : public testing::Test {
+
+    protected:
+
+      static VkDebugUtilsMessengerCallbackDataEXT callbackData(const int32_t& id, const char* message) {
+        VkDebugUtilsMessengerCallbackDataEXT data = {};
+        data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
+        data.messageIdNumber = id;
+        data.pMessage = message;
+        return data;
+      }
+
+  };
+
+  TEST_F(MessengerTests, test1) {
+    try {
+      std::ostringstream out;
+      Messenger messenger(
+          out,
+          MessengerCreateInfo()
+              .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning)
+              .setToStringFunction([](auto, auto, std::string message) {return message;})
+      );
+
+      VkDebugUtilsMessengerCallbackDataEXT info = callbackData(1, "info");
+      VkDebugUtilsMessengerCallbackDataEXT warning = callbackData(2, "warning");
+      Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT, &info, &messenger);
+      Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT, &warning, &messenger);
+
+      ASSERT_EQ(1, messenger.filteredCount.load());
+      ASSERT_EQ(1, messenger.writtenCount.load());
+      ASSERT_EQ("warning\n", out.str());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MessengerTests, test2) {
+    try {
+      std::ostringstream out;
+      {
+        Messenger messenger(
+            out,
+            MessengerCreateInfo()
+                .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning)
+                .setToStringFunction([](auto, auto, std::string message) {return message;})
+                .setAsync(true)
+                .setQueueCapacity(16)
+                .setDuplicateLimit(2)
+                .setDuplicateWindow(std::chrono::hours(1))
+        );
+
+        VkDebugUtilsMessengerCallbackDataEXT warning = callbackData(3, "warning");
+        for (size_t i = 0; i < 5; i++) {
+          Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &warning, &messenger);
+        }
+
+        ASSERT_EQ(3, messenger.suppressedCount.load());
+        messenger.stop();
+        ASSERT_EQ(2, messenger.writtenCount.load());
+      }
+
+      std::string result = out.str();
+      ASSERT_EQ(2, std::count(result.begin(), result.end(), '\n') - 1);
+      ASSERT_NE(std::string::npos, result.find("messenger: suppressed: 3 dropped: 0"));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MessengerTests, test3) {
+    try {
+      std::ostringstream out;
+      Messenger messenger(
+          out,
+          MessengerCreateInfo()
+              .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning)
+              .setToStringFunction([](auto, auto, std::string message) {return message;})
+              .setDuplicateLimit(1)
+              .setDuplicateWindow(std::chrono::hours(1))
+      );
+
+      VkDebugUtilsMessengerCallbackDataEXT warning1 = callbackData(3, "warning1");
+      VkDebugUtilsMessengerCallbackDataEXT warning2 = callbackData(static_cast<int32_t>(3 + Messenger::DUPLICATE_BUCKET_COUNT), "warning2");
+      Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &warning1, &messenger);
+      Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &warning1, &messenger);
+      Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &warning2, &messenger);
+
+      ASSERT_EQ(1, messenger.suppressedCount.load());
+      ASSERT_EQ(2, messenger.writtenCount.load());
+      ASSERT_EQ("warning1\nwarning2\n", out.str());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(MessengerTests, test4) {
+    try {
+      std::ostringstream out;
+      {
+        Messenger messenger(
+            out,
+            MessengerCreateInfo()
+                .setExceptionSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eError)
+                .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning)
+                .setToStringFunction([](auto, auto, std::string message) {return message;})
+                .setAsync(true)
+                .setQueueCapacity(16)
+        );
+
+        VkDebugUtilsMessengerCallbackDataEXT warning = callbackData(1, "warning");
+        VkDebugUtilsMessengerCallbackDataEXT error = callbackData(2, "error");
+        Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &warning, &messenger);
+        ASSERT_THROW(
+            Messenger::callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT, &error, &messenger),
+            std::runtime_error
+        );
+        messenger.stop();
+        ASSERT_EQ(1, messenger.writtenCount.load());
+      }
+
+      std::string result = out.str();
+      ASSERT_NE(std::string::npos, result.find("warning\n"));
+      ASSERT_NE(std::string::npos, result.find("error\n"));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
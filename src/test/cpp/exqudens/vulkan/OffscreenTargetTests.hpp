@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class OffscreenTargetTests : public testing::Test {
+  };
+
+  TEST_F(OffscreenTargetTests, test1) {
+    try {
+      TestContext& context = TestContext::get();
+
+      OffscreenTarget offscreenTarget = OffscreenTarget::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setQueue(context.graphicsQueue.value)
+          .setCommandPool(*context.graphicsCommandPool.reference())
+          .setFormat(vk::Format::eR8G8B8A8Unorm)
+          .setExtent(vk::Extent2D().setWidth(4).setHeight(4))
+          .setImageCount(2)
+          .setUsage(vk::ImageUsageFlagBits::eTransferDst)
+          .setLayout(vk::ImageLayout::eTransferDstOptimal)
+      .build();
+      ASSERT_EQ(vk::ImageLayout::eTransferDstOptimal, offscreenTarget.layout);
+      ASSERT_EQ(4 * 4 * 4, offscreenTarget.readbackSize());
+
+      auto [result, index] = offscreenTarget.acquireNextImage(std::numeric_limits<uint64_t>::max(), {});
+      ASSERT_EQ(vk::Result::eSuccess, result);
+
+      vk::Image image = *offscreenTarget.images[index].reference();
+      context.submit([&image](vk::raii::CommandBuffer& commandBuffer) {
+        vk::ImageSubresourceRange subresourceRange = vk::ImageSubresourceRange()
+            .setAspectMask(vk::ImageAspectFlagBits::eColor)
+            .setBaseMipLevel(0)
+            .setLevelCount(1)
+            .setBaseArrayLayer(0)
+            .setLayerCount(1);
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTopOfPipe,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::DependencyFlags(0),
+            {},
+            {},
+            {
+                vk::ImageMemoryBarrier()
+                    .setSrcAccessMask(vk::AccessFlags())
+                    .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
+                    .setOldLayout(vk::ImageLayout::eUndefined)
+                    .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
+                    .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+                    .setImage(image)
+                    .setSubresourceRange(subresourceRange)
+            }
+        );
+        commandBuffer.clearColorImage(
+            image,
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::ClearColorValue().setFloat32({1.0f, 0.0f, 0.0f, 1.0f}),
+            {subresourceRange}
+        );
+      });
+
+      ASSERT_EQ(vk::Result::eSuccess, offscreenTarget.present({}, index));
+      vk::Result waitResult = context.device.reference().waitForFences(
+          {*offscreenTarget.readbackFences[index].reference()},
+          true,
+          std::numeric_limits<uint64_t>::max()
+      );
+      ASSERT_EQ(vk::Result::eSuccess, waitResult);
+      ASSERT_EQ(index, offscreenTarget.latestReadbackIndex());
+
+      const auto* data = static_cast<const uint8_t*>(offscreenTarget.readback(index));
+      ASSERT_NE(nullptr, data);
+      for (vk::DeviceSize i = 0; i < offscreenTarget.readbackSize(); i += 4) {
+        ASSERT_EQ(std::vector<uint8_t>({255, 0, 0, 255}), std::vector<uint8_t>(data + i, data + i + 4));
+      }
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iterator>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/PipelineCacheStore.hpp"
+
+namespace exqudens::vulkan {
+
+  class PipelineCacheStoreTests : public testing::Test {
+
+    protected:
+
+      static vk::PhysicalDeviceProperties properties() {
+        vk::PhysicalDeviceProperties result = {};
+        result.vendorID = 0x10DE;
+        result.deviceID = 0x2484;
+        for (size_t i = 0; i < VK_UUID_SIZE; i++) {
+          result.pipelineCacheUUID[i] = static_cast<uint8_t>(i + 1);
+        }
+        return result;
+      }
+
+      static std::vector<char> header(const vk::PhysicalDeviceProperties& properties, const uint32_t& payloadSize) {
+        uint32_t values[4] = {
+            static_cast<uint32_t>(4 * sizeof(uint32_t) + VK_UUID_SIZE),
+            static_cast<uint32_t>(vk::PipelineCacheHeaderVersion::eOne),
+            properties.vendorID,
+            properties.deviceID
+        };
+        std::vector<char> result(sizeof(values) + VK_UUID_SIZE + payloadSize, 0);
+        std::memcpy(result.data(), values, sizeof(values));
+        std::memcpy(result.data() + sizeof(values), properties.pipelineCacheUUID.data(), VK_UUID_SIZE);
+        return result;
+      }
+
+  };
+
+  TEST_F(PipelineCacheStoreTests, test1) {
+    try {
+      vk::PhysicalDeviceProperties expected = properties();
+      std::vector<char> data = header(expected, 64);
+      ASSERT_TRUE(PipelineCacheStore::isCompatible(data, expected));
+      ASSERT_FALSE(PipelineCacheStore::isCompatible(std::vector<char>(data.begin(), data.begin() + 16), expected));
+
+      vk::PhysicalDeviceProperties other = expected;
+      other.deviceID++;
+      ASSERT_FALSE(PipelineCacheStore::isCompatible(data, other));
+
+      other = expected;
+      other.pipelineCacheUUID[VK_UUID_SIZE - 1]++;
+      ASSERT_FALSE(PipelineCacheStore::isCompatible(data, other));
+
+      std::vector<char> invalid = data;
+      invalid[4] = 2;
+      ASSERT_FALSE(PipelineCacheStore::isCompatible(invalid, expected));
+
+      invalid = data;
+      uint32_t length = static_cast<uint32_t>(data.size() + 1);
+      std::memcpy(invalid.data(), &length, sizeof(length));
+      ASSERT_FALSE(PipelineCacheStore::isCompatible(invalid, expected));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PipelineCacheStoreTests, test2) {
+    try {
+      std::filesystem::path directory = std::filesystem::temp_directory_path() / "exqudens-vulkan-pipeline-cache-store-tests";
+      std::filesystem::remove_all(directory);
+      std::string path = (directory / "nested" / "pipeline.cache").string();
+
+      PipelineCacheStore::write(path, {1, 2, 3});
+      PipelineCacheStore::write(path, {4, 5, 6, 7});
+
+      std::ifstream file(path, std::ios::binary);
+      std::vector<char> actual((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      file.close();
+      ASSERT_EQ(std::vector<char>({4, 5, 6, 7}), actual);
+      ASSERT_FALSE(std::filesystem::exists(path + ".tmp"));
+
+      std::filesystem::remove_all(directory);
+
+      PipelineCacheStore store = {};
+      ASSERT_THROW(store.save(), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
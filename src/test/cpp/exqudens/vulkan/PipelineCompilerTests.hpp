@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <memory>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class PipelineCompilerTests : public testing::Test {
+  };
+
+  TEST_F(PipelineCompilerTests, test1) {
+    try {
+      std::mutex mutex;
+      std::set<std::thread::id> threadIds;
+      std::vector<std::future<uint32_t>> futures;
+      {
+        PipelineCompiler::Pool pool(4);
+        for (uint32_t i = 0; i < 64; i++) {
+          futures.emplace_back(pool.submit([i, &mutex, &threadIds]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            threadIds.insert(std::this_thread::get_id());
+            return i * i;
+          }));
+        }
+        std::future<uint32_t> failed = pool.submit([]() -> uint32_t {
+          throw std::runtime_error("failed");
+        });
+        ASSERT_THROW(failed.get(), std::runtime_error);
+      }
+
+      for (uint32_t i = 0; i < futures.size(); i++) {
+        ASSERT_EQ(i * i, futures[i].get());
+      }
+      ASSERT_FALSE(threadIds.empty());
+      ASSERT_LE(threadIds.size(), 4);
+      ASSERT_FALSE(threadIds.contains(std::this_thread::get_id()));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PipelineCompilerTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+      std::string path = std::filesystem::path().append("resources").append("shader").append("shader-5.comp.spv").make_preferred().string();
+
+      std::shared_ptr<ShaderModuleCache> shaderModuleCache = std::make_shared<ShaderModuleCache>(
+          ShaderModuleCache::builder()
+              .setDevice(context.device.value)
+          .build()
+      );
+
+      PipelineCompiler pipelineCompiler = PipelineCompiler::builder()
+          .setDevice(context.device.value)
+          .setThreadCount(2)
+      .build();
+
+      Pipeline::Builder builder = Pipeline::builder()
+          .setDevice(context.device.value)
+          .setShaderModuleCache(shaderModuleCache)
+          .setReflectLayouts(true)
+          .setComputeCreateInfo(vk::ComputePipelineCreateInfo())
+          .addPath(path);
+
+      std::vector<Pipeline> pipelines = pipelineCompiler.compileBatch({builder, builder}).get();
+      ASSERT_EQ(2, pipelines.size());
+      for (Pipeline& pipeline : pipelines) {
+        ASSERT_TRUE(pipeline.value);
+        ASSERT_TRUE(pipeline.computeCreateInfo);
+        ASSERT_FALSE(pipeline.graphicsCreateInfo);
+      }
+      ASSERT_NE(*pipelines[0].reference(), *pipelines[1].reference());
+
+      Pipeline pipeline = pipelineCompiler.compile(builder).get();
+      ASSERT_TRUE(pipeline.value);
+
+      std::vector<std::future<Pipeline>> futures = pipelineCompiler.compileAll({builder, builder});
+      ASSERT_EQ(2, futures.size());
+      for (std::future<Pipeline>& future : futures) {
+        ASSERT_TRUE(future.get().value);
+      }
+
+      ASSERT_EQ(1, shaderModuleCache->size());
+      ASSERT_EQ(1, shaderModuleCache->missCount);
+      ASSERT_EQ(4, shaderModuleCache->hitCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <limits>
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class PipelineTests : public testing::Test {
+
+    protected:
+
+      struct Constants {
+        uint32_t count = 0;
+        uint32_t factor = 0;
+      };
+
+      static std::string computeShaderPath() {
+        return std::filesystem::path().append("resources").append("shader").append("shader-5.comp.spv").make_preferred().string();
+      }
+
+  };
+
+  TEST_F(PipelineTests, test1) {
+    try {
+      ASSERT_EQ(0, Utility::groupCount(0, 64));
+      ASSERT_EQ(1, Utility::groupCount(1, 64));
+      ASSERT_EQ(1, Utility::groupCount(64, 64));
+      ASSERT_EQ(2, Utility::groupCount(65, 64));
+      ASSERT_EQ(7, Utility::groupCount(7, 1));
+      ASSERT_EQ(67108864, Utility::groupCount(std::numeric_limits<uint32_t>::max(), 64));
+      ASSERT_THROW(Utility::groupCount(64, 0), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PipelineTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+      const uint32_t count = 100;
+      const vk::DeviceSize size = count * sizeof(uint32_t);
+
+      Pipeline pipeline = Pipeline::builder()
+          .setDevice(context.device.value)
+          .setReflectLayouts(true)
+          .setComputeCreateInfo(vk::ComputePipelineCreateInfo())
+          .addPath(computeShaderPath())
+      .build();
+      ASSERT_EQ(1, pipeline.setLayouts.size());
+
+      Buffer buffer = Buffer::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setCreateInfo(
+              vk::BufferCreateInfo()
+                  .setSize(size)
+                  .setUsage(vk::BufferUsageFlagBits::eStorageBuffer)
+                  .setSharingMode(vk::SharingMode::eExclusive)
+          )
+          .setMemoryCreateInfo(vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent)
+      .build();
+      auto* values = static_cast<uint32_t*>(buffer.mapMemory(0, size));
+      std::memset(values, 0, size);
+
+      DescriptorPool descriptorPool = DescriptorPool::builder()
+          .setDevice(context.device.value)
+          .addPoolSize(vk::DescriptorPoolSize().setType(vk::DescriptorType::eStorageBuffer).setDescriptorCount(1))
+          .setCreateInfo(
+              vk::DescriptorPoolCreateInfo()
+                  .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+                  .setMaxSets(1)
+          )
+      .build();
+      DescriptorSet descriptorSet = DescriptorSet::builder()
+          .setDevice(context.device.value)
+          .addSetLayout(pipeline.setLayouts.front())
+          .setCreateInfo(vk::DescriptorSetAllocateInfo().setDescriptorPool(*descriptorPool.reference()))
+          .setWrites({
+              WriteDescriptorSet()
+                  .setDstBinding(0)
+                  .setDstArrayElement(0)
+                  .setDescriptorCount(1)
+                  .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                  .setBufferInfo({vk::DescriptorBufferInfo().setBuffer(*buffer.reference()).setOffset(0).setRange(size)})
+          })
+      .build();
+
+      Constants constants = {count, 3};
+      context.submit([&pipeline, &descriptorSet, &constants, &count](vk::raii::CommandBuffer& commandBuffer) {
+        pipeline.dispatch(commandBuffer, {*descriptorSet.reference()}, constants, Utility::groupCount(count, 64));
+      });
+
+      for (uint32_t i = 0; i < count; i++) {
+        ASSERT_EQ(i * constants.factor, values[i]);
+      }
+      buffer.unmapMemory();
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PipelineTests, test3) {
+    try {
+      TestContext& context = TestContext::get();
+
+      ASSERT_THROW(
+          Pipeline::builder()
+              .setDevice(context.device.value)
+              .setGraphicsCreateInfo(GraphicsPipelineCreateInfo())
+              .addPath(computeShaderPath())
+          .build(),
+          std::runtime_error
+      );
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(PipelineTests, test4) {
+    try {
+      TestContext& context = TestContext::get();
+
+      vk::PhysicalDeviceDynamicRenderingFeaturesKHR requested = vk::PhysicalDeviceDynamicRenderingFeaturesKHR()
+          .setDynamicRendering(true);
+      auto chain = context.physicalDevice.reference().getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDynamicRenderingFeaturesKHR>();
+      if (!PhysicalDevice::isSupported(requested, chain.get<vk::PhysicalDeviceDynamicRenderingFeaturesKHR>())) {
+        GTEST_SKIP() << "dynamic rendering is not supported";
+      }
+
+      PhysicalDevice physicalDevice = PhysicalDevice::builder()
+          .setInstance(context.instance.value)
+          .setDynamicRenderingFeatures(requested)
+          .addQueueType(vk::QueueFlagBits::eGraphics)
+          .setQueuePriority(1.0f)
+      .build();
+
+      Device device = Device::builder()
+          .setPhysicalDevice(physicalDevice)
+          .setCreateInfo(
+              vk::DeviceCreateInfo()
+                  .setQueueCreateInfos(physicalDevice.uniqueQueueCreateInfos)
+                  .setPEnabledFeatures(&physicalDevice.features)
+                  .setPEnabledExtensionNames(physicalDevice.enabledExtensionNames)
+                  .setPEnabledLayerNames(context.instance.enabledLayerNames)
+          )
+      .build();
+      ASSERT_TRUE(device.isExtensionEnabled(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME));
+
+      Pipeline pipeline = Pipeline::builder()
+          .setDevice(device.value)
+          .addPath(std::filesystem::path().append("resources").append("shader").append("shader-1.vert.spv").make_preferred().string())
+          .addPath(std::filesystem::path().append("resources").append("shader").append("shader-1.frag.spv").make_preferred().string())
+          .setGraphicsCreateInfo(
+              GraphicsPipelineCreateInfo()
+                  .setColorAttachmentFormats({vk::Format::eR8G8B8A8Unorm})
+                  .setVertexInputState(PipelineVertexInputStateCreateInfo())
+                  .setInputAssemblyState(
+                      vk::PipelineInputAssemblyStateCreateInfo()
+                          .setTopology(vk::PrimitiveTopology::eTriangleList)
+                          .setPrimitiveRestartEnable(false)
+                  )
+                  .setDynamicViewport()
+                  .setRasterizationState(
+                      vk::PipelineRasterizationStateCreateInfo()
+                          .setPolygonMode(vk::PolygonMode::eFill)
+                          .setCullMode(vk::CullModeFlagBits::eNone)
+                          .setFrontFace(vk::FrontFace::eClockwise)
+                          .setLineWidth(1.0)
+                  )
+                  .setMultisampleState(
+                      vk::PipelineMultisampleStateCreateInfo()
+                          .setRasterizationSamples(vk::SampleCountFlagBits::e1)
+                  )
+                  .setColorBlendState(
+                      PipelineColorBlendStateCreateInfo()
+                          .setAttachments({
+                              vk::PipelineColorBlendAttachmentState()
+                                  .setBlendEnable(false)
+                                  .setColorWriteMask(vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG | vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA)
+                          })
+                  )
+          )
+      .build();
+
+      ASSERT_TRUE(pipeline.value);
+      ASSERT_TRUE(pipeline.graphicsCreateInfo.value().renderingCreateInfo);
+      ASSERT_EQ(1, pipeline.graphicsCreateInfo.value().renderingCreateInfo.value().colorAttachmentCount);
+      ASSERT_EQ(vk::RenderPass(), pipeline.graphicsCreateInfo.value().renderPass);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class ShaderModuleCacheTests : public testing::Test {
+  };
+
+  TEST_F(ShaderModuleCacheTests, test1) {
+    try {
+      std::vector<uint32_t> code1 = {0x07230203, 0x00010000, 0, 16, 0};
+      std::vector<uint32_t> code2 = code1;
+      std::vector<uint32_t> code3 = code1;
+      code3[3] = 17;
+
+      ASSERT_EQ(ShaderModuleCache::hash(code1.data(), code1.size()), ShaderModuleCache::hash(code2.data(), code2.size()));
+      ASSERT_NE(ShaderModuleCache::hash(code1.data(), code1.size()), ShaderModuleCache::hash(code3.data(), code3.size()));
+      ASSERT_NE(ShaderModuleCache::hash(code1.data(), code1.size()), ShaderModuleCache::hash(code1.data(), code1.size() - 1));
+
+      ShaderModuleCache cache = ShaderModuleCache::builder().build();
+      ASSERT_EQ(0, cache.size());
+      ASSERT_THROW(cache.get(std::vector<char>(6, 0)), std::runtime_error);
+      ASSERT_EQ(0, cache.hitCount);
+      ASSERT_EQ(0, cache.missCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderModuleCacheTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+      std::string path = std::filesystem::path().append("resources").append("shader").append("shader-5.comp.spv").make_preferred().string();
+      std::vector<char> bytes = Utility::readFile(path);
+
+      std::shared_ptr<ShaderModuleCache> cache = std::make_shared<ShaderModuleCache>(
+          ShaderModuleCache::builder()
+              .setDevice(context.device.value)
+          .build()
+      );
+
+      Pipeline pipeline1 = Pipeline::builder()
+          .setDevice(context.device.value)
+          .setShaderModuleCache(cache)
+          .setReflectLayouts(true)
+          .setComputeCreateInfo(vk::ComputePipelineCreateInfo())
+          .addPath(path)
+      .build();
+      Pipeline pipeline2 = Pipeline::builder()
+          .setDevice(context.device.value)
+          .setShaderModuleCache(cache)
+          .setReflectLayouts(true)
+          .setComputeCreateInfo(vk::ComputePipelineCreateInfo())
+          .addPath(path)
+      .build();
+
+      ASSERT_EQ(1, cache->size());
+      ASSERT_EQ(1, cache->hitCount);
+      ASSERT_EQ(1, cache->missCount);
+      ASSERT_EQ(**pipeline1.shaders.at(path).second, **pipeline2.shaders.at(path).second);
+
+      cache->clear();
+      ASSERT_EQ(0, cache->size());
+
+      const vk::ShaderModuleCreateInfo& createInfo = pipeline1.shaders.at(path).first;
+      ASSERT_EQ(bytes.size(), createInfo.codeSize);
+      ASSERT_TRUE(std::equal(bytes.begin(), bytes.end(), reinterpret_cast<const char*>(createInfo.pCode)));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
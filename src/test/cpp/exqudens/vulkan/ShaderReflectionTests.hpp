@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "resources/shader/shader-4.vert.hpp"
+#include "resources/shader/shader-4.frag.hpp"
+#include "exqudens/vulkan/Vertex.hpp"
+#include "exqudens/vulkan/ShaderReflection.hpp"
+
+namespace exqudens::vulkan {
+
+  class ShaderReflectionTests : public testing::Test {
+
+    protected:
+
+      static void add(std::vector<uint32_t>& code, const uint32_t& opcode, const std::vector<uint32_t>& operands) {
+        code.emplace_back((static_cast<uint32_t>(operands.size() + 1) << 16) | opcode);
+        code.insert(code.end(), operands.begin(), operands.end());
+      }
+
+      static std::vector<uint32_t> header() {
+        return {ShaderReflection::MAGIC_NUMBER, 0x00010000, 0, 100, 0};
+      }
+
+      static void addTypes(std::vector<uint32_t>& code) {
+        add(code, ShaderReflection::OP_TYPE_FLOAT, {2, 32});
+        add(code, ShaderReflection::OP_TYPE_VECTOR, {3, 2, 4});
+        add(code, ShaderReflection::OP_TYPE_STRUCT, {11, 3, 2});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {12, ShaderReflection::STORAGE_CLASS_UNIFORM, 11});
+        add(code, ShaderReflection::OP_TYPE_STRUCT, {13, 2, 3});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {14, ShaderReflection::STORAGE_CLASS_PUSH_CONSTANT, 13});
+        add(code, ShaderReflection::OP_VARIABLE, {12, 21, ShaderReflection::STORAGE_CLASS_UNIFORM});
+        add(code, ShaderReflection::OP_VARIABLE, {14, 22, ShaderReflection::STORAGE_CLASS_PUSH_CONSTANT});
+      }
+
+      static void addDecorations(std::vector<uint32_t>& code) {
+        add(code, ShaderReflection::OP_DECORATE, {21, ShaderReflection::DECORATION_DESCRIPTOR_SET, 0});
+        add(code, ShaderReflection::OP_DECORATE, {21, ShaderReflection::DECORATION_BINDING, 2});
+        add(code, ShaderReflection::OP_DECORATE, {11, ShaderReflection::DECORATION_BLOCK});
+        add(code, ShaderReflection::OP_MEMBER_DECORATE, {11, 0, ShaderReflection::DECORATION_OFFSET, 0});
+        add(code, ShaderReflection::OP_MEMBER_DECORATE, {11, 1, ShaderReflection::DECORATION_OFFSET, 16});
+        add(code, ShaderReflection::OP_DECORATE, {13, ShaderReflection::DECORATION_BLOCK});
+        add(code, ShaderReflection::OP_MEMBER_DECORATE, {13, 0, ShaderReflection::DECORATION_OFFSET, 16});
+        add(code, ShaderReflection::OP_MEMBER_DECORATE, {13, 1, ShaderReflection::DECORATION_OFFSET, 32});
+      }
+
+      static std::vector<uint32_t> fragmentCode() {
+        std::vector<uint32_t> code = header();
+        add(code, ShaderReflection::OP_ENTRY_POINT, {4, 50, 0x6E69616D, 0});
+        addDecorations(code);
+        add(code, ShaderReflection::OP_DECORATE, {20, ShaderReflection::DECORATION_DESCRIPTOR_SET, 1});
+        add(code, ShaderReflection::OP_DECORATE, {20, ShaderReflection::DECORATION_BINDING, 0});
+        add(code, ShaderReflection::OP_DECORATE, {23, ShaderReflection::DECORATION_DESCRIPTOR_SET, 0});
+        add(code, ShaderReflection::OP_DECORATE, {23, ShaderReflection::DECORATION_BINDING, 5});
+        add(code, ShaderReflection::OP_DECORATE, {15, ShaderReflection::DECORATION_BUFFER_BLOCK});
+        addTypes(code);
+        add(code, ShaderReflection::OP_TYPE_INT, {4, 32, 0});
+        add(code, ShaderReflection::OP_CONSTANT, {4, 5, 3});
+        add(code, ShaderReflection::OP_TYPE_IMAGE, {6, 2, 1, 0, 0, 0, 1, 0});
+        add(code, ShaderReflection::OP_TYPE_SAMPLED_IMAGE, {7, 6});
+        add(code, ShaderReflection::OP_TYPE_ARRAY, {8, 7, 5});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {9, ShaderReflection::STORAGE_CLASS_UNIFORM_CONSTANT, 8});
+        add(code, ShaderReflection::OP_TYPE_STRUCT, {15, 3});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {16, ShaderReflection::STORAGE_CLASS_UNIFORM, 15});
+        add(code, ShaderReflection::OP_VARIABLE, {9, 20, ShaderReflection::STORAGE_CLASS_UNIFORM_CONSTANT});
+        add(code, ShaderReflection::OP_VARIABLE, {16, 23, ShaderReflection::STORAGE_CLASS_UNIFORM});
+        return code;
+      }
+
+      static std::vector<uint32_t> vertexCode() {
+        std::vector<uint32_t> code = header();
+        add(code, ShaderReflection::OP_ENTRY_POINT, {0, 50, 0x6E69616D, 0, 30, 31, 32, 33});
+        addDecorations(code);
+        add(code, ShaderReflection::OP_DECORATE, {30, ShaderReflection::DECORATION_LOCATION, 0});
+        add(code, ShaderReflection::OP_DECORATE, {31, ShaderReflection::DECORATION_LOCATION, 2});
+        add(code, ShaderReflection::OP_DECORATE, {32, ShaderReflection::DECORATION_LOCATION, 1});
+        add(code, ShaderReflection::OP_DECORATE, {33, ShaderReflection::DECORATION_BUILT_IN, 42});
+        addTypes(code);
+        add(code, ShaderReflection::OP_TYPE_VECTOR, {40, 2, 3});
+        add(code, ShaderReflection::OP_TYPE_VECTOR, {41, 2, 2});
+        add(code, ShaderReflection::OP_TYPE_INT, {42, 32, 1});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {43, ShaderReflection::STORAGE_CLASS_INPUT, 40});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {44, ShaderReflection::STORAGE_CLASS_INPUT, 41});
+        add(code, ShaderReflection::OP_TYPE_POINTER, {45, ShaderReflection::STORAGE_CLASS_INPUT, 42});
+        add(code, ShaderReflection::OP_VARIABLE, {43, 30, ShaderReflection::STORAGE_CLASS_INPUT});
+        add(code, ShaderReflection::OP_VARIABLE, {44, 31, ShaderReflection::STORAGE_CLASS_INPUT});
+        add(code, ShaderReflection::OP_VARIABLE, {45, 32, ShaderReflection::STORAGE_CLASS_INPUT});
+        add(code, ShaderReflection::OP_VARIABLE, {45, 33, ShaderReflection::STORAGE_CLASS_INPUT});
+        return code;
+      }
+
+  };
+
+  TEST_F(ShaderReflectionTests, test1) {
+    try {
+      ShaderReflection reflection = ShaderReflection::reflect(fragmentCode());
+
+      ASSERT_EQ(vk::ShaderStageFlags(vk::ShaderStageFlagBits::eFragment), reflection.stages);
+      ASSERT_EQ("main", reflection.entryPoint);
+      ASSERT_EQ(2, reflection.setCount());
+
+      std::vector<vk::DescriptorSetLayoutBinding> set0 = reflection.setBindings(0);
+      ASSERT_EQ(2, set0.size());
+      ASSERT_EQ(2, set0[0].binding);
+      ASSERT_EQ(vk::DescriptorType::eUniformBuffer, set0[0].descriptorType);
+      ASSERT_EQ(5, set0[1].binding);
+      ASSERT_EQ(vk::DescriptorType::eStorageBuffer, set0[1].descriptorType);
+
+      std::vector<vk::DescriptorSetLayoutBinding> set1 = reflection.setBindings(1);
+      ASSERT_EQ(1, set1.size());
+      ASSERT_EQ(vk::DescriptorType::eCombinedImageSampler, set1[0].descriptorType);
+      ASSERT_EQ(3, set1[0].descriptorCount);
+
+      ASSERT_EQ(1, reflection.pushConstantRanges.size());
+      ASSERT_EQ(16, reflection.pushConstantRanges[0].offset);
+      ASSERT_EQ(32, reflection.pushConstantRanges[0].size);
+      ASSERT_TRUE(reflection.vertexAttributes.empty());
+
+      std::vector<uint32_t> invalid = fragmentCode();
+      invalid[0] = 0;
+      ASSERT_THROW(ShaderReflection::reflect(invalid), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderReflectionTests, test2) {
+    try {
+      ShaderReflection vertex = ShaderReflection::reflect(vertexCode());
+
+      ASSERT_EQ(3, vertex.vertexAttributes.size());
+      ASSERT_EQ(vk::Format::eR32G32B32Sfloat, vertex.vertexAttributes[0].format);
+      ASSERT_EQ(0, vertex.vertexAttributes[0].offset);
+      ASSERT_EQ(vk::Format::eR32Sint, vertex.vertexAttributes[1].format);
+      ASSERT_EQ(12, vertex.vertexAttributes[1].offset);
+      ASSERT_EQ(vk::Format::eR32G32Sfloat, vertex.vertexAttributes[2].format);
+      ASSERT_EQ(16, vertex.vertexAttributes[2].offset);
+      ASSERT_EQ(24, vertex.vertexStride);
+
+      ShaderReflection merged = ShaderReflection::merge({vertex, ShaderReflection::reflect(fragmentCode())});
+      vk::ShaderStageFlags stages = vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment;
+
+      ASSERT_EQ(stages, merged.stages);
+      ASSERT_EQ(stages, merged.setBindings(0)[0].stageFlags);
+      ASSERT_EQ(vk::ShaderStageFlags(vk::ShaderStageFlagBits::eFragment), merged.setBindings(0)[1].stageFlags);
+      ASSERT_EQ(1, merged.pushConstantRanges.size());
+      ASSERT_EQ(stages, merged.pushConstantRanges[0].stageFlags);
+      ASSERT_EQ(3, merged.vertexAttributes.size());
+      ASSERT_EQ(24, merged.vertexBindingDescription().stride);
+      ASSERT_THROW(ShaderReflection::merge({vertex, vertex}), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderReflectionTests, test3) {
+    try {
+      ShaderReflection reflection = ShaderReflection::merge({
+          ShaderReflection::reflect(shader::SHADER_4_VERT),
+          ShaderReflection::reflect(shader::SHADER_4_FRAG)
+      });
+      std::vector<vk::VertexInputAttributeDescription> attributes = Vertex::getAttributeDescriptions();
+
+      ASSERT_EQ(1, reflection.setCount());
+      ASSERT_EQ(2, reflection.setBindings(0).size());
+      ASSERT_EQ(vk::DescriptorType::eUniformBuffer, reflection.setBindings(0)[0].descriptorType);
+      ASSERT_EQ(vk::ShaderStageFlags(vk::ShaderStageFlagBits::eVertex), reflection.setBindings(0)[0].stageFlags);
+      ASSERT_EQ(vk::DescriptorType::eCombinedImageSampler, reflection.setBindings(0)[1].descriptorType);
+      ASSERT_EQ(vk::ShaderStageFlags(vk::ShaderStageFlagBits::eFragment), reflection.setBindings(0)[1].stageFlags);
+      ASSERT_TRUE(reflection.pushConstantRanges.empty());
+      ASSERT_EQ(attributes, reflection.vertexAttributes);
+      ASSERT_EQ(Vertex::getBindingDescription(), reflection.vertexBindingDescription());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
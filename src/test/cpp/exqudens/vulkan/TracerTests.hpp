@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/Tracer.hpp"
+
+namespace exqudens::vulkan {
+
+  class TracerTests : public testing::Test {
+  };
+
+  TEST_F(TracerTests, test1) {
+    try {
+      Tracer tracer = Tracer::builder()
+          .setMaxEvents(2)
+      .build();
+
+      tracer.record("acq\"uire", "cpu", tracer.origin + std::chrono::microseconds(10), tracer.origin + std::chrono::microseconds(15));
+      ASSERT_THROW(tracer.recordGpu("renderPass", 1000, 3500), std::runtime_error);
+      tracer.calibrate(1000, tracer.origin + std::chrono::microseconds(20));
+      tracer.recordGpu("renderPass", 1000, 3500);
+      tracer.record("present", "cpu", tracer.origin, tracer.origin);
+
+      ASSERT_EQ(2, tracer.events.size());
+      ASSERT_EQ(1, tracer.droppedEvents);
+      ASSERT_EQ(Tracer::GPU_THREAD_ID, tracer.events[1].threadId);
+      ASSERT_EQ(20000, tracer.events[1].begin);
+      ASSERT_EQ(2500, tracer.events[1].duration);
+
+      std::string json = tracer.toJson();
+      ASSERT_NE(std::string::npos, json.find("\"name\":\"acq\\\"uire\""));
+      ASSERT_NE(std::string::npos, json.find("\"ts\":10.000,\"dur\":5.000"));
+      ASSERT_NE(std::string::npos, json.find("\"ts\":20.000,\"dur\":2.500"));
+      ASSERT_EQ('}', json.back());
+
+      tracer.clear();
+      ASSERT_TRUE(tracer.events.empty());
+      ASSERT_EQ(0, tracer.droppedEvents);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
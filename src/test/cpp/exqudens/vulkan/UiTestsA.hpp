@@ -37,6 +37,7 @@ namespace exqudens::vulkan {
         public:
 
           bool resized = false;
+          bool pushDescriptor = false;
 
         private:
           inline static const size_t MAX_FRAMES_IN_FLIGHT = 2;
@@ -54,31 +55,30 @@ namespace exqudens::vulkan {
           CommandPool transferCommandPool = {};
           CommandPool graphicsCommandPool = {};
           CommandBuffer transferCommandBuffer = {};
-          std::vector<CommandBuffer> graphicsCommandBuffers = std::vector<CommandBuffer>(MAX_FRAMES_IN_FLIGHT);
+          std::shared_ptr<Tracer> tracer = {};
+          FrameRing<MAX_FRAMES_IN_FLIGHT> frameRing;
+          GpuProfiler gpuProfiler = {};
           DescriptorSetLayout descriptorSetLayout = {};
           Swapchain swapchain = {};
           std::vector<ImageView> swapchainImageViews = {};
           Image depthImage = {};
           ImageView depthImageView = {};
           RenderPass renderPass = {};
+          PipelineCacheStore pipelineCacheStore = {};
           Pipeline pipeline = {};
           std::vector<Framebuffer> swapchainFramebuffers = {};
-          Buffer textureBuffer = {};
+          UploadQueue uploadQueue = {};
+          uint64_t uploadId = 0;
           Image textureImage = {};
           ImageView textureImageView = {};
-          Buffer vertexStagingBuffer = {};
           Buffer vertexBuffer = {};
-          Buffer indexStagingBuffer = {};
           Buffer indexBuffer = {};
-          std::vector<Buffer> uniformBuffers = std::vector<Buffer>(MAX_FRAMES_IN_FLIGHT);
+          UniformRing uniformRing = {};
           Sampler sampler = {};
-          std::vector<Semaphore> imageAvailableSemaphores = std::vector<Semaphore>(MAX_FRAMES_IN_FLIGHT);
-          std::vector<Semaphore> renderFinishedSemaphores = std::vector<Semaphore>(MAX_FRAMES_IN_FLIGHT);
-          std::vector<Fence> inFlightFences = std::vector<Fence>(MAX_FRAMES_IN_FLIGHT);
           DescriptorPool descriptorPool = {};
-          std::vector<DescriptorSet> descriptorSets = std::vector<DescriptorSet>(MAX_FRAMES_IN_FLIGHT);
+          DescriptorSet descriptorSet = {};
+          bool depthImageBarrierRequired = false;
 
-          size_t currentFrame = 0;
 
         public:
 
@@ -133,13 +133,16 @@ namespace exqudens::vulkan {
                           .setApplicationVersion(VK_MAKE_VERSION(1, 0, 0))
                           .setPEngineName("Exqudens Engine")
                           .setEngineVersion(VK_MAKE_VERSION(1, 0, 0))
-                          .setApiVersion(VK_API_VERSION_1_0)
+                          // VK_KHR_push_descriptor depends on vkGetPhysicalDeviceProperties2, core since 1.1
+                          .setApiVersion(pushDescriptor ? VK_API_VERSION_1_1 : VK_API_VERSION_1_0)
                   )
                   .setMessengerCreateInfo(
                       MessengerCreateInfo()
                           .setExceptionSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eError)
                           .setOutSeverity(vk::DebugUtilsMessageSeverityFlagBitsEXT::eVerbose)
                           .setToStringFunction(&Utility::toString)
+                          .setAsync(true)
+                          .setDuplicateLimit(10)
                   )
                   .setDebugUtilsMessengerCreateInfo(
                       vk::DebugUtilsMessengerCreateInfoEXT()
@@ -175,8 +178,15 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("physicalDevice: '{}'", (bool) physicalDevice.value) << std::endl;
 
+              if (pushDescriptor) {
+                std::vector<vk::ExtensionProperties> extensionProperties = physicalDevice.reference().enumerateDeviceExtensionProperties(nullptr);
+                if (std::ranges::any_of(extensionProperties, [](const vk::ExtensionProperties& o1) {return std::string(o1.extensionName.data()) == VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME;})) {
+                  physicalDevice.enabledExtensionNames.emplace_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+                }
+              }
+
               device = Device::builder()
-                  .setPhysicalDevice(physicalDevice.value)
+                  .setPhysicalDevice(physicalDevice)
                   .setCreateInfo(
                       vk::DeviceCreateInfo()
                           .setQueueCreateInfos(physicalDevice.uniqueQueueCreateInfos)
@@ -187,19 +197,31 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("device: '{}'", (bool) device.value) << std::endl;
 
+              pipelineCacheStore = PipelineCacheStore::builder()
+                  .setPhysicalDevice(physicalDevice.value)
+                  .setDevice(device.value)
+                  .setPath(std::filesystem::path().append("resources").append("pipeline-cache.bin").make_preferred().string())
+              .build();
+              std::cout << std::format("pipelineCacheStore: '{}'", (bool) pipelineCacheStore.value) << std::endl;
+
+              tracer = std::make_shared<Tracer>(Tracer::builder().build());
+
               transferQueue = Queue::builder()
                   .setDevice(device.value)
                   .setFamilyIndex(physicalDevice.transferQueueCreateInfos.front().queueFamilyIndex)
+                  .setTracer(tracer)
               .build();
               std::cout << std::format("transferQueue: '{}'", (bool) transferQueue.value) << std::endl;
               graphicsQueue = Queue::builder()
                   .setDevice(device.value)
                   .setFamilyIndex(physicalDevice.graphicsQueueCreateInfos.front().queueFamilyIndex)
+                  .setTracer(tracer)
               .build();
               std::cout << std::format("graphicsQueue: '{}'", (bool) graphicsQueue.value) << std::endl;
               presentQueue = Queue::builder()
                   .setDevice(device.value)
                   .setFamilyIndex(physicalDevice.presentQueueCreateInfos.front().queueFamilyIndex)
+                  .setTracer(tracer)
               .build();
               std::cout << std::format("presentQueue: '{}'", (bool) presentQueue.value) << std::endl;
 
@@ -233,25 +255,33 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("transferCommandBuffer: '{}'", (bool) transferCommandBuffer.value) << std::endl;
 
-              for (auto& commandBuffer : graphicsCommandBuffers) {
-                commandBuffer = CommandBuffer::builder()
-                    .setDevice(device.value)
-                    .setCreateInfo(
-                        vk::CommandBufferAllocateInfo()
-                            .setCommandPool(*graphicsCommandPool.reference())
-                            .setCommandBufferCount(1)
-                            .setLevel(vk::CommandBufferLevel::ePrimary)
-                    )
-                .build();
-              }
-              std::ranges::for_each(graphicsCommandBuffers, [](const auto& o1) {std::cout << std::format("graphicsCommandBuffer: '{}'", (bool) o1.value) << std::endl;});
+              frameRing = FrameRing<MAX_FRAMES_IN_FLIGHT>::builder()
+                  .setDevice(device.value)
+                  .setTracer(tracer)
+                  .setCommandPool(*graphicsCommandPool.reference())
+              .build();
+              std::ranges::for_each(frameRing.frames, [](const auto& o1) {std::cout << std::format("frame: '{}'", (bool) o1.commandBuffer.value && (bool) o1.inFlightFence.value) << std::endl;});
+
+              gpuProfiler = GpuProfiler::builder()
+                  .setPhysicalDevice(physicalDevice.value)
+                  .setDevice(device.value)
+                  .setTracer(tracer)
+                  .setQueueFamilyIndex(graphicsQueue.familyIndex)
+                  .setFrameCount(MAX_FRAMES_IN_FLIGHT)
+              .build();
+              gpuProfiler.calibrate(graphicsQueue.reference(), frameRing.frames.front().commandBuffer.reference());
+              std::cout << std::format("gpuProfiler: '{}'", (bool) gpuProfiler.value) << std::endl;
 
+              // push descriptors cannot hold dynamic uniform buffers, the pushed binding carries the ring offset instead
+              bool push = pushDescriptor && DescriptorSetLayout::isPushDescriptorSupported(device);
               descriptorSetLayout = DescriptorSetLayout::builder()
                   .setDevice(device.value)
+                  .setPushDescriptor(push)
+                  .setPushDescriptorSupported(push)
                   .addBinding(
                       vk::DescriptorSetLayoutBinding()
                           .setBinding(0)
-                          .setDescriptorType(vk::DescriptorType::eUniformBuffer)
+                          .setDescriptorType(push ? vk::DescriptorType::eUniformBuffer : vk::DescriptorType::eUniformBufferDynamic)
                           .setDescriptorCount(1)
                           .setStageFlags(vk::ShaderStageFlagBits::eVertex)
                   )
@@ -263,24 +293,22 @@ namespace exqudens::vulkan {
                           .setStageFlags(vk::ShaderStageFlagBits::eFragment)
                   )
               .build();
-              std::cout << std::format("descriptorSetLayout: '{}'", (bool) descriptorSetLayout.value) << std::endl;
+              std::cout << std::format("descriptorSetLayout: '{}' pushDescriptor: '{}'", (bool) descriptorSetLayout.value, descriptorSetLayout.pushDescriptor) << std::endl;
 
               createSwapchain(width, height);
+              createPipeline();
+              createFramebuffers();
 
-              textureBuffer = Buffer::builder()
+              uploadQueue = UploadQueue::builder()
                   .setPhysicalDevice(physicalDevice.value)
                   .setDevice(device.value)
-                  .setCreateInfo(
-                      vk::BufferCreateInfo()
-                          .setSize(tmpImageWidth * tmpImageHeight * tmpImageDepth)
-                          .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
-                          .setSharingMode(vk::SharingMode::eExclusive)
-                  )
-                  .setMemoryCreateInfo(
-                      vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-                  )
+                  .setQueue(transferQueue.value)
+                  .setSrcQueueFamilyIndex(transferQueue.familyIndex)
+                  .setDstQueueFamilyIndex(graphicsQueue.familyIndex)
+                  .setStagingSize(16 * 1024 * 1024)
               .build();
-              std::cout << std::format("textureBuffer: '{}'", (bool) textureBuffer.value) << std::endl;
+              std::cout << std::format("uploadQueue: '{}'", (bool) uploadQueue.stagingBuffer.value) << std::endl;
+
               textureImage = Image::builder()
                   .setPhysicalDevice(physicalDevice.value)
                   .setDevice(device.value)
@@ -326,26 +354,12 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("textureImageView: '{}'", (bool) textureImageView.value) << std::endl;
 
-              vertexStagingBuffer = Buffer::builder()
-                  .setPhysicalDevice(physicalDevice.value)
-                  .setDevice(device.value)
-                  .setCreateInfo(
-                      vk::BufferCreateInfo()
-                          .setSize(sizeof(vertexVector[0]) * vertexVector.size())
-                          .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
-                          .setSharingMode(vk::SharingMode::eExclusive)
-                  )
-                  .setMemoryCreateInfo(
-                      vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-                  )
-              .build();
-              std::cout << std::format("vertexStagingBuffer: '{}'", (bool) vertexStagingBuffer.value) << std::endl;
               vertexBuffer = Buffer::builder()
                   .setPhysicalDevice(physicalDevice.value)
                   .setDevice(device.value)
                   .setCreateInfo(
                       vk::BufferCreateInfo()
-                          .setSize(vertexStagingBuffer.createInfo.size)
+                          .setSize(sizeof(vertexVector[0]) * vertexVector.size())
                           .setUsage(vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer)
                           .setSharingMode(vk::SharingMode::eExclusive)
                   )
@@ -353,26 +367,12 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("vertexBuffer: '{}'", (bool) vertexBuffer.value) << std::endl;
 
-              indexStagingBuffer = Buffer::builder()
-                  .setPhysicalDevice(physicalDevice.value)
-                  .setDevice(device.value)
-                  .setCreateInfo(
-                      vk::BufferCreateInfo()
-                          .setSize(sizeof(indexVector[0]) * indexVector.size())
-                          .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
-                          .setSharingMode(vk::SharingMode::eExclusive)
-                  )
-                  .setMemoryCreateInfo(
-                      vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-                  )
-              .build();
-              std::cout << std::format("indexStagingBuffer: '{}'", (bool) indexStagingBuffer.value) << std::endl;
               indexBuffer = Buffer::builder()
                   .setPhysicalDevice(physicalDevice.value)
                   .setDevice(device.value)
                   .setCreateInfo(
                       vk::BufferCreateInfo()
-                          .setSize(indexStagingBuffer.createInfo.size)
+                          .setSize(sizeof(indexVector[0]) * indexVector.size())
                           .setUsage(vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer)
                           .setSharingMode(vk::SharingMode::eExclusive)
                   )
@@ -380,22 +380,12 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("indexBuffer: '{}'", (bool) indexBuffer.value) << std::endl;
 
-              for (auto& uniformBuffer : uniformBuffers) {
-                uniformBuffer = Buffer::builder()
-                    .setPhysicalDevice(physicalDevice.value)
-                    .setDevice(device.value)
-                    .setCreateInfo(
-                        vk::BufferCreateInfo()
-                            .setSize(sizeof(UniformBufferObject) * uniformBuffers.size())
-                            .setUsage(vk::BufferUsageFlagBits::eUniformBuffer)
-                            .setSharingMode(vk::SharingMode::eExclusive)
-                    )
-                    .setMemoryCreateInfo(
-                        vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-                    )
-                .build();
-              }
-              std::ranges::for_each(uniformBuffers, [](auto& o1) {std::cout << std::format("uniformBuffer: '{}'", (bool) o1.value) << std::endl;});
+              uniformRing = UniformRing::builder()
+                  .setPhysicalDevice(physicalDevice.value)
+                  .setDevice(device.value)
+                  .setFrameCount(MAX_FRAMES_IN_FLIGHT)
+              .build();
+              std::cout << std::format("uniformRing: '{}'", (bool) uniformRing.buffer.value) << std::endl;
 
               sampler = Sampler::builder()
                   .setDevice(device.value)
@@ -417,49 +407,28 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("sampler: '{}'", (bool) sampler.value) << std::endl;
 
-              for (auto& imageAvailableSemaphore : imageAvailableSemaphores) {
-                imageAvailableSemaphore = Semaphore::builder().setDevice(device.value).build();
-              }
-              std::ranges::for_each(imageAvailableSemaphores, [](auto& o1) {std::cout << std::format("imageAvailableSemaphore: '{}'", (bool) o1.value) << std::endl;});
-
-              for (auto& renderFinishedSemaphore : renderFinishedSemaphores) {
-                renderFinishedSemaphore = Semaphore::builder().setDevice(device.value).build();
-              }
-              std::ranges::for_each(renderFinishedSemaphores, [](auto& o1) {std::cout << std::format("renderFinishedSemaphore: '{}'", (bool) o1.value) << std::endl;});
-
-              for (auto& inFlightFence : inFlightFences) {
-                inFlightFence = Fence::builder()
+              if (!descriptorSetLayout.pushDescriptor) {
+                descriptorPool = DescriptorPool::builder()
                     .setDevice(device.value)
+                    .addPoolSize(
+                        vk::DescriptorPoolSize()
+                            .setType(vk::DescriptorType::eUniformBufferDynamic)
+                            .setDescriptorCount(1)
+                    )
+                    .addPoolSize(
+                        vk::DescriptorPoolSize()
+                            .setType(vk::DescriptorType::eCombinedImageSampler)
+                            .setDescriptorCount(1)
+                    )
                     .setCreateInfo(
-                        vk::FenceCreateInfo()
-                            .setFlags(vk::FenceCreateFlagBits::eSignaled)
+                        vk::DescriptorPoolCreateInfo()
+                            .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
+                            .setMaxSets(1)
                     )
                 .build();
-              }
-              std::ranges::for_each(inFlightFences, [](auto& o1) {std::cout << std::format("inFlightFence: '{}'", (bool) o1.value) << std::endl;});
+                std::cout << std::format("descriptorPool: '{}'", (bool) descriptorPool.value) << std::endl;
 
-              descriptorPool = DescriptorPool::builder()
-                  .setDevice(device.value)
-                  .addPoolSize(
-                      vk::DescriptorPoolSize()
-                          .setType(vk::DescriptorType::eUniformBuffer)
-                          .setDescriptorCount(MAX_FRAMES_IN_FLIGHT)
-                  )
-                  .addPoolSize(
-                      vk::DescriptorPoolSize()
-                          .setType(vk::DescriptorType::eCombinedImageSampler)
-                          .setDescriptorCount(MAX_FRAMES_IN_FLIGHT)
-                  )
-                  .setCreateInfo(
-                      vk::DescriptorPoolCreateInfo()
-                          .setFlags(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet)
-                          .setMaxSets(MAX_FRAMES_IN_FLIGHT)
-                  )
-              .build();
-              std::cout << std::format("descriptorPool: '{}'", (bool) descriptorPool.value) << std::endl;
-
-              for (size_t i = 0 ; i < descriptorSets.size(); i++) {
-                descriptorSets[i] = DescriptorSet::builder()
+                descriptorSet = DescriptorSet::builder()
                     .setDevice(device.value)
                     .addSetLayout(*descriptorSetLayout.reference())
                     .setCreateInfo(
@@ -467,157 +436,72 @@ namespace exqudens::vulkan {
                             .setDescriptorPool(*descriptorPool.reference())
                             .setDescriptorSetCount(1)
                     )
-                    .setWrites({
-                        WriteDescriptorSet()
-                            .setDstBinding(0)
-                            .setDstArrayElement(0)
-                            .setDescriptorCount(1)
-                            .setDescriptorType(vk::DescriptorType::eUniformBuffer)
-                            .setBufferInfo({
-                                vk::DescriptorBufferInfo()
-                                    .setBuffer(*uniformBuffers[i].reference())
-                                    .setOffset(0)
-                                    .setRange(sizeof(UniformBufferObject))
-                            }),
-                        WriteDescriptorSet()
-                            .setDstBinding(1)
-                            .setDstArrayElement(0)
-                            .setDescriptorCount(1)
-                            .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
-                            .setImageInfo({
-                                vk::DescriptorImageInfo()
-                                    .setSampler(*sampler.reference())
-                                    .setImageView(*textureImageView.reference())
-                                    .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
-                            })
-                    })
+                    .setWrites(createWrites(vk::DescriptorType::eUniformBufferDynamic, 0))
                 .build();
+                std::cout << std::format("descriptorSet: '{}'", (bool) descriptorSet.value) << std::endl;
               }
-              std::ranges::for_each(descriptorSets, [](auto& o1) {std::cout << std::format("descriptorSet: '{}'", (bool) o1.value) << std::endl;});
-
-              void* tmpData = textureBuffer.memoryReference().mapMemory(0, textureBuffer.createInfo.size);
-              std::memcpy(tmpData, tmpImageData.data(), static_cast<size_t>(textureBuffer.createInfo.size));
-              textureBuffer.memoryReference().unmapMemory();
 
-              tmpData = vertexStagingBuffer.memoryReference().mapMemory(0, vertexStagingBuffer.createInfo.size);
-              std::memcpy(tmpData, vertexVector.data(), static_cast<size_t>(vertexStagingBuffer.createInfo.size));
-              vertexStagingBuffer.memoryReference().unmapMemory();
-
-              tmpData = indexStagingBuffer.memoryReference().mapMemory(0, indexStagingBuffer.createInfo.size);
-              std::memcpy(tmpData, indexVector.data(), static_cast<size_t>(indexStagingBuffer.createInfo.size));
-              indexStagingBuffer.memoryReference().unmapMemory();
-
-              transferCommandBuffer.reference().begin({});
-
-              insertDepthImagePipelineBarrier(transferCommandBuffer.reference());
-
-              transferCommandBuffer.reference().pipelineBarrier(
-                  vk::PipelineStageFlagBits::eTopOfPipe,
-                  vk::PipelineStageFlagBits::eTransfer,
-                  vk::DependencyFlags(0),
-                  {},
-                  {},
-                  {
-                      vk::ImageMemoryBarrier()
-                          .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
-                          .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
-                          .setImage(*textureImage.reference())
-                          .setOldLayout(vk::ImageLayout::eUndefined)
-                          .setNewLayout(vk::ImageLayout::eTransferDstOptimal)
-                          .setSrcAccessMask(vk::AccessFlagBits::eNoneKHR)
-                          .setDstAccessMask(vk::AccessFlagBits::eTransferWrite)
-                          .setSubresourceRange(
-                              vk::ImageSubresourceRange()
-                                  .setAspectMask(vk::ImageAspectFlagBits::eColor)
-                                  .setBaseMipLevel(0)
-                                  .setLevelCount(1)
-                                  .setBaseArrayLayer(0)
-                                  .setLayerCount(1)
-                          )
-                  }
-              );
-              transferCommandBuffer.reference().copyBufferToImage(
-                  *textureBuffer.reference(),
+              uploadQueue.uploadImage(
+                  tmpImageData.data(),
+                  tmpImageData.size(),
                   *textureImage.reference(),
-                  vk::ImageLayout::eTransferDstOptimal,
-                  {
-                      vk::BufferImageCopy()
-                          .setBufferOffset(0)
-                          .setBufferRowLength(0)
-                          .setImageOffset(
-                              vk::Offset3D()
-                                  .setX(0)
-                                  .setY(0)
-                                  .setZ(0)
-                          )
-                          .setImageExtent(
-                              vk::Extent3D()
-                                  .setWidth(textureImage.createInfo.extent.width)
-                                  .setHeight(textureImage.createInfo.extent.height)
-                                  .setDepth(1)
-                          )
-                          .setImageSubresource(
-                              vk::ImageSubresourceLayers()
-                                  .setAspectMask(vk::ImageAspectFlagBits::eColor)
-                                  .setMipLevel(0)
-                                  .setBaseArrayLayer(0)
-                                  .setLayerCount(1)
-                          )
-                  }
-              );
-              transferCommandBuffer.reference().pipelineBarrier(
-                  vk::PipelineStageFlagBits::eTransfer,
-                  vk::PipelineStageFlagBits::eFragmentShader,
-                  vk::DependencyFlags(0),
-                  {},
-                  {},
-                  {
-                      vk::ImageMemoryBarrier()
-                          .setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
-                          .setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
-                          .setImage(*textureImage.reference())
-                          .setOldLayout(vk::ImageLayout::eTransferDstOptimal)
-                          .setNewLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
-                          .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
-                          .setDstAccessMask(vk::AccessFlagBits::eShaderRead)
-                          .setSubresourceRange(
-                              vk::ImageSubresourceRange()
-                                  .setAspectMask(vk::ImageAspectFlagBits::eColor)
-                                  .setBaseMipLevel(0)
-                                  .setLevelCount(1)
-                                  .setBaseArrayLayer(0)
-                                  .setLayerCount(1)
-                          )
-                  }
+                  vk::BufferImageCopy()
+                      .setBufferOffset(0)
+                      .setBufferRowLength(0)
+                      .setImageOffset(
+                          vk::Offset3D()
+                              .setX(0)
+                              .setY(0)
+                              .setZ(0)
+                      )
+                      .setImageExtent(
+                          vk::Extent3D()
+                              .setWidth(textureImage.createInfo.extent.width)
+                              .setHeight(textureImage.createInfo.extent.height)
+                              .setDepth(1)
+                      )
+                      .setImageSubresource(
+                          vk::ImageSubresourceLayers()
+                              .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                              .setMipLevel(0)
+                              .setBaseArrayLayer(0)
+                              .setLayerCount(1)
+                      ),
+                  vk::ImageLayout::eShaderReadOnlyOptimal,
+                  vk::AccessFlagBits::eShaderRead,
+                  vk::PipelineStageFlagBits::eFragmentShader
               );
-
-              transferCommandBuffer.reference().copyBuffer(
-                  *vertexStagingBuffer.reference(),
+              uploadQueue.uploadBuffer(
+                  vertexVector.data(),
+                  vertexBuffer.createInfo.size,
                   *vertexBuffer.reference(),
-                  {
-                      vk::BufferCopy()
-                          .setSize(vertexStagingBuffer.createInfo.size)
-                  }
+                  0,
+                  vk::AccessFlagBits::eVertexAttributeRead,
+                  vk::PipelineStageFlagBits::eVertexInput
               );
-
-              transferCommandBuffer.reference().copyBuffer(
-                  *indexStagingBuffer.reference(),
+              uploadQueue.uploadBuffer(
+                  indexVector.data(),
+                  indexBuffer.createInfo.size,
                   *indexBuffer.reference(),
-                  {
-                      vk::BufferCopy()
-                          .setSize(indexStagingBuffer.createInfo.size)
-                  }
+                  0,
+                  vk::AccessFlagBits::eIndexRead,
+                  vk::PipelineStageFlagBits::eVertexInput
               );
+              uploadId = uploadQueue.flush();
+
+              transferCommandBuffer.reference().begin({});
+
+              insertDepthImagePipelineBarrier(transferCommandBuffer.reference());
 
               transferCommandBuffer.reference().end();
-              transferQueue.reference().submit(
+              transferQueue.submit(
                   {
                     vk::SubmitInfo()
                       .setCommandBufferCount(1)
                       .setPCommandBuffers(&(*transferCommandBuffer.reference()))
                   }
               );
-              transferQueue.reference().waitIdle();
+              transferQueue.waitIdle();
 
               std::cout << std::format("{} ... done", CALL_INFO()) << std::endl;
             } catch (...) {
@@ -633,6 +517,8 @@ namespace exqudens::vulkan {
                   .setDevice(device.value)
                   .addGraphicsQueueFamilyIndex(physicalDevice.graphicsQueueCreateInfos.front().queueFamilyIndex)
                   .addPresentQueueFamilyIndex(physicalDevice.presentQueueCreateInfos.front().queueFamilyIndex)
+                  .setOldSwapchain(swapchain.value)
+                  .setTracer(tracer)
                   .setCreateInfo(
                       Utility::swapChainCreateInfo(
                           physicalDevice.reference(),
@@ -716,6 +602,16 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("depthImageView: '{}'", (bool) depthImageView.value) << std::endl;
 
+              std::cout << std::format("{} ... done", CALL_INFO()) << std::endl;
+            } catch (...) {
+              std::throw_with_nested(std::runtime_error(CALL_INFO()));
+            }
+          }
+
+          void createPipeline() {
+            try {
+              std::cout << std::format("{} ... call", CALL_INFO()) << std::endl;
+
               renderPass = RenderPass::builder()
                   .setDevice(device.value)
                   .addAttachment(
@@ -770,6 +666,7 @@ namespace exqudens::vulkan {
                   .setDevice(device.value)
                   .addPath("resources/shader/shader-4.vert.spv")
                   .addPath("resources/shader/shader-4.frag.spv")
+                  .setCache(pipelineCacheStore.value)
                   .addSetLayout(*descriptorSetLayout.reference())
                   .setGraphicsCreateInfo(
                       GraphicsPipelineCreateInfo()
@@ -785,23 +682,7 @@ namespace exqudens::vulkan {
                                   .setTopology(vk::PrimitiveTopology::eTriangleList)
                                   .setPrimitiveRestartEnable(false)
                           )
-                          .setViewportState(
-                              PipelineViewportStateCreateInfo()
-                                  .setViewports({
-                                      vk::Viewport()
-                                          .setWidth((float) swapchain.createInfo.imageExtent.width)
-                                          .setHeight((float) swapchain.createInfo.imageExtent.height)
-                                          .setMinDepth(0.0)
-                                          .setMaxDepth(1.0)
-                                          .setX(0.0)
-                                          .setY(0.0)
-                                  })
-                                  .setScissors({
-                                      vk::Rect2D()
-                                          .setOffset({0, 0})
-                                          .setExtent(swapchain.createInfo.imageExtent)
-                                  })
-                          )
+                          .setDynamicViewport()
                           .setRasterizationState(
                               vk::PipelineRasterizationStateCreateInfo()
                                   .setDepthClampEnable(false)
@@ -857,6 +738,16 @@ namespace exqudens::vulkan {
               .build();
               std::cout << std::format("pipeline: '{}'", (bool) pipeline.value) << std::endl;
 
+              std::cout << std::format("{} ... done", CALL_INFO()) << std::endl;
+            } catch (...) {
+              std::throw_with_nested(std::runtime_error(CALL_INFO()));
+            }
+          }
+
+          void createFramebuffers() {
+            try {
+              std::cout << std::format("{} ... call", CALL_INFO()) << std::endl;
+
               for (auto& imageView : swapchainImageViews) {
                 swapchainFramebuffers.emplace_back(
                     Framebuffer::builder()
@@ -922,33 +813,18 @@ namespace exqudens::vulkan {
             try {
               std::cout << std::format("{} ... call", CALL_INFO()) << std::endl;
 
-              device.reference().waitIdle();
-
-              std::ranges::for_each(swapchainFramebuffers, [](auto& o1) {o1.value.reset();});
+              std::ranges::for_each(swapchainFramebuffers, [this](auto& o1) {frameRing.retire(o1.value);});
               swapchainFramebuffers.clear();
-              pipeline.value.reset();
-              renderPass.value.reset();
-              depthImageView.value.reset();
-              depthImage.value.reset();
-              std::ranges::for_each(swapchainImageViews, [](auto& o1) {o1.value.reset();});
+              frameRing.retire(depthImageView.value);
+              frameRing.retire(depthImage.value);
+              frameRing.retire(depthImage.memory);
+              std::ranges::for_each(swapchainImageViews, [this](auto& o1) {frameRing.retire(o1.value);});
               swapchainImageViews.clear();
-              swapchain.value.reset();
+              frameRing.retire(swapchain.value);
 
               createSwapchain(width, height);
-
-              transferCommandBuffer.reference().begin({});
-
-              insertDepthImagePipelineBarrier(transferCommandBuffer.reference());
-
-              transferCommandBuffer.reference().end();
-              transferQueue.reference().submit(
-                  {
-                      vk::SubmitInfo()
-                          .setCommandBufferCount(1)
-                          .setPCommandBuffers(&(*transferCommandBuffer.reference()))
-                  }
-              );
-              transferQueue.reference().waitIdle();
+              createFramebuffers();
+              depthImageBarrierRequired = true;
 
               std::cout << std::format("{} ... done", CALL_INFO()) << std::endl;
             } catch (...) {
@@ -958,35 +834,39 @@ namespace exqudens::vulkan {
 
           void drawFrame(int width, int height) {
             try {
-              vk::Result result = device.reference().waitForFences(
-                  {*inFlightFences[currentFrame].reference()},
-                  true,
-                  UINT64_MAX
-              );
-              if (vk::Result::eSuccess != result) {
-                throw std::runtime_error(CALL_INFO() + ": failed to 'device.waitForFences(...)'!");
-              }
-
-              std::vector<uint32_t> imageIndices = {};
-              {
-                std::pair<vk::Result, uint32_t> pair = swapchain
-                    .reference()
-                    .acquireNextImage(UINT64_MAX, *imageAvailableSemaphores[currentFrame].reference());
-                result = pair.first;
-                imageIndices.emplace_back(pair.second);
-              }
+              vk::Result result = frameRing.begin(swapchain);
               if (vk::Result::eErrorOutOfDateKHR == result) {
                 reCreateSwapchain(width, height);
                 return;
-              } else if (vk::Result::eSuccess != result && vk::Result::eSuboptimalKHR != result) {
-                throw std::runtime_error("failed to 'swapChain.acquireNextImage(...)'!");
               }
 
-              updateUniformBuffer();
-              device.reference().resetFences({*inFlightFences[currentFrame].reference()});
-              graphicsCommandBuffers[currentFrame].reference().reset();
+              uint32_t uniformOffset = updateUniformBuffer();
+
+              recordCommandBuffer(frameRing.commandBufferReference(), uniformOffset);
+
+              frameRing.submit(graphicsQueue);
+
+              result = frameRing.present(presentQueue, swapchain);
+              if (vk::Result::eErrorOutOfDateKHR == result || vk::Result::eSuboptimalKHR == result || resized) {
+                resized = false;
+                reCreateSwapchain(width, height);
+              } else if (vk::Result::eSuccess != result) {
+                throw std::runtime_error("failed to 'presentQueue.presentKHR(...)'!");
+              }
+            } catch (...) {
+              std::throw_with_nested(std::runtime_error(CALL_INFO()));
+            }
+          }
 
-              graphicsCommandBuffers[currentFrame].reference().begin({});
+          void recordCommandBuffer(vk::raii::CommandBuffer& commandBuffer, uint32_t uniformOffset) {
+            try {
+              TRACE_SCOPE(tracer, "record");
+              gpuProfiler.beginFrame(commandBuffer, frameRing.currentFrame);
+              bool uploaded = uploadQueue.recordAcquire(commandBuffer, uploadId);
+              if (depthImageBarrierRequired) {
+                insertDepthImagePipelineBarrier(commandBuffer);
+                depthImageBarrierRequired = false;
+              }
               std::vector<vk::ClearValue> clearValues = {
                   vk::ClearValue()
                       .setColor(
@@ -1001,10 +881,12 @@ namespace exqudens::vulkan {
                       )
               };
 
-              graphicsCommandBuffers[currentFrame].reference().beginRenderPass(
+              uint32_t renderPassScope = gpuProfiler.begin(commandBuffer, "renderPass");
+
+              commandBuffer.beginRenderPass(
                   vk::RenderPassBeginInfo()
                       .setRenderPass(*renderPass.reference())
-                      .setFramebuffer(*swapchainFramebuffers[imageIndices.front()].reference())
+                      .setFramebuffer(*swapchainFramebuffers[frameRing.imageIndex].reference())
                       .setRenderArea(
                           vk::Rect2D()
                               .setOffset(
@@ -1018,47 +900,23 @@ namespace exqudens::vulkan {
                   vk::SubpassContents::eInline
               );
 
-              graphicsCommandBuffers[currentFrame].reference().bindPipeline(vk::PipelineBindPoint::eGraphics, *pipeline.reference());
-              graphicsCommandBuffers[currentFrame].reference().bindVertexBuffers(0, {*vertexBuffer.reference()}, {0});
-              graphicsCommandBuffers[currentFrame].reference().bindIndexBuffer(*indexBuffer.reference(), 0, vk::IndexType::eUint16);
-              graphicsCommandBuffers[currentFrame].reference().bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *pipeline.layoutReference(), 0, {*descriptorSets[currentFrame].reference()}, {});
-              graphicsCommandBuffers[currentFrame].reference().drawIndexed(indexVector.size(), 1, 0, 0, 0);
-
-              graphicsCommandBuffers[currentFrame].reference().endRenderPass();
-              graphicsCommandBuffers[currentFrame].reference().end();
-
-              std::vector<vk::PipelineStageFlags> waitDstStageMask = {vk::PipelineStageFlagBits::eColorAttachmentOutput};
-              std::vector<vk::Semaphore> waitSemaphores = {*imageAvailableSemaphores[currentFrame].reference()};
-              std::vector<vk::Semaphore> signalSemaphores = {*renderFinishedSemaphores[currentFrame].reference()};
-              std::vector<vk::CommandBuffer> commandBuffers = {*graphicsCommandBuffers[currentFrame].reference()};
-
-              graphicsQueue.reference().submit(
-                  {
-                      vk::SubmitInfo()
-                          .setWaitDstStageMask(waitDstStageMask)
-                          .setWaitSemaphores(waitSemaphores)
-                          .setSignalSemaphores(signalSemaphores)
-                          .setCommandBuffers(commandBuffers)
-                  },
-                  *inFlightFences[currentFrame].reference()
-              );
-
-              std::vector<vk::SwapchainKHR> swapchains = {*swapchain.reference()};
-
-              result = presentQueue.reference().presentKHR(
-                  vk::PresentInfoKHR()
-                      .setWaitSemaphores(signalSemaphores)
-                      .setSwapchains(swapchains)
-                      .setImageIndices(imageIndices)
-              );
-              if (vk::Result::eErrorOutOfDateKHR == result || vk::Result::eSuboptimalKHR == result || resized) {
-                resized = false;
-                reCreateSwapchain(width, height);
-              } else if (vk::Result::eSuccess != result) {
-                throw std::runtime_error("failed to 'swapChain.acquireNextImage(...)'!");
+              if (uploaded) {
+                commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *pipeline.reference());
+                pipeline.setDynamicViewport(commandBuffer, swapchain.createInfo.imageExtent);
+                commandBuffer.bindVertexBuffers(0, {*vertexBuffer.reference()}, {0});
+                commandBuffer.bindIndexBuffer(*indexBuffer.reference(), 0, vk::IndexType::eUint16);
+                if (descriptorSetLayout.pushDescriptor) {
+                  std::vector<WriteDescriptorSet> writes = createWrites(vk::DescriptorType::eUniformBuffer, uniformOffset);
+                  commandBuffer.pushDescriptorSetKHR(vk::PipelineBindPoint::eGraphics, *pipeline.layoutReference(), 0, std::vector<vk::WriteDescriptorSet>(writes.begin(), writes.end()));
+                } else {
+                  commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, *pipeline.layoutReference(), 0, {*descriptorSet.reference()}, {uniformOffset});
+                }
+                commandBuffer.drawIndexed(indexVector.size(), 1, 0, 0, 0);
               }
 
-              currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+              commandBuffer.endRenderPass();
+
+              gpuProfiler.end(commandBuffer, renderPassScope);
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
             }
@@ -1072,8 +930,23 @@ namespace exqudens::vulkan {
             }
           }
 
-          void updateUniformBuffer() {
+          void destroy() {
             try {
+              for (const auto& [name, stats] : gpuProfiler.stats()) {
+                std::cout << std::format("gpuProfiler: '{}' count: {} min: {:.3f} ms avg: {:.3f} ms p99: {:.3f} ms", name, stats.count, stats.min, stats.avg, stats.p99) << std::endl;
+              }
+              if (!tracer->events.empty()) {
+                tracer->write("ui-tests-a-trace.json");
+              }
+              pipelineCacheStore.save();
+            } catch (...) {
+              std::throw_with_nested(std::runtime_error(CALL_INFO()));
+            }
+          }
+
+          uint32_t updateUniformBuffer() {
+            try {
+              TRACE_SCOPE(tracer, "uniformUpdate");
               static auto startTime = std::chrono::high_resolution_clock::now();
 
               auto currentTime = std::chrono::high_resolution_clock::now();
@@ -1085,10 +958,34 @@ namespace exqudens::vulkan {
               ubo.proj = glm::perspective(glm::radians(45.0f), (float) swapchain.createInfo.imageExtent.width / (float) swapchain.createInfo.imageExtent.height, 0.1f, 10.0f);
               ubo.proj[1][1] *= -1;
 
-              Buffer& buffer = uniformBuffers[currentFrame];
-              void* tmpData = buffer.memoryReference().mapMemory(0, buffer.createInfo.size);
-              std::memcpy(tmpData, &ubo, static_cast<size_t>(buffer.createInfo.size));
-              buffer.memoryReference().unmapMemory();
+              uniformRing.beginFrame(frameRing.currentFrame);
+              return uniformRing.push(ubo);
+            } catch (...) {
+              std::throw_with_nested(std::runtime_error(CALL_INFO()));
+            }
+          }
+
+          std::vector<WriteDescriptorSet> createWrites(const vk::DescriptorType& uniformType, const uint32_t& uniformOffset) {
+            try {
+              return {
+                  WriteDescriptorSet()
+                      .setDstBinding(0)
+                      .setDstArrayElement(0)
+                      .setDescriptorCount(1)
+                      .setDescriptorType(uniformType)
+                      .setBufferInfo({uniformRing.descriptorBufferInfo(sizeof(UniformBufferObject)).setOffset(uniformOffset)}),
+                  WriteDescriptorSet()
+                      .setDstBinding(1)
+                      .setDstArrayElement(0)
+                      .setDescriptorCount(1)
+                      .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                      .setImageInfo({
+                          vk::DescriptorImageInfo()
+                              .setSampler(*sampler.reference())
+                              .setImageView(*textureImageView.reference())
+                              .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal)
+                      })
+              };
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
             }
@@ -1102,8 +999,9 @@ namespace exqudens::vulkan {
 
           std::vector<std::string> arguments = {};
           TestRenderer* renderer = nullptr;
+          bool pushDescriptor = false;
 
-          TestUiApplication(const int& argc, char** argv) {
+          TestUiApplication(const int& argc, char** argv, const bool& pushDescriptor = false): pushDescriptor(pushDescriptor) {
             try {
               for (std::size_t i = 0; i < argc; i++) {
                 arguments.emplace_back(std::string(argv[i]));
@@ -1134,6 +1032,7 @@ namespace exqudens::vulkan {
               std::vector<const char*> glfwInstanceRequiredExtensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
 
               renderer = new TestRenderer();
+              renderer->pushDescriptor = pushDescriptor;
               renderer->create(
                   arguments,
                   glfwInstanceRequiredExtensions,
@@ -1152,6 +1051,7 @@ namespace exqudens::vulkan {
                 renderer->drawFrame(width, height);
               }
               renderer->waitIdle();
+              renderer->destroy();
 
               delete renderer;
               glfwDestroyWindow(window);
@@ -1205,4 +1105,17 @@ namespace exqudens::vulkan {
     }
   }
 
+  TEST_F(UiTestsA, test2) {
+    try {
+      std::string executableDir = TestUtils::getExecutableDir();
+      std::vector<char*> arguments = {executableDir.data()};
+      int argc = static_cast<int>(arguments.size());
+      char** argv = &arguments[0];
+      int result = TestUiApplication(argc, argv, true).run();
+      ASSERT_EQ(EXIT_SUCCESS, result);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
 }
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "TestContext.hpp"
+#include "exqudens/vulkan/all.hpp"
+
+namespace exqudens::vulkan {
+
+  class UniformRingTests : public testing::Test {
+  };
+
+  TEST_F(UniformRingTests, test1) {
+    try {
+      UniformRing uniformRing = {};
+      uint32_t value = 1;
+
+      ASSERT_THROW(uniformRing.beginFrame(0), std::runtime_error);
+      ASSERT_THROW(uniformRing.push(value), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(UniformRingTests, test2) {
+    try {
+      TestContext& context = TestContext::get();
+      vk::DeviceSize alignment = context.physicalDevice.reference().getProperties().limits.minUniformBufferOffsetAlignment;
+
+      UniformRing uniformRing = UniformRing::builder()
+          .setPhysicalDevice(context.physicalDevice.value)
+          .setDevice(context.device.value)
+          .setFrameSize(alignment + 2 * sizeof(uint32_t))
+          .setFrameCount(2)
+      .build();
+
+      ASSERT_EQ(alignment, uniformRing.alignment);
+      ASSERT_EQ(MemoryBlock::alignUp(alignment + 2 * sizeof(uint32_t), alignment), uniformRing.frameSize);
+      ASSERT_EQ(uniformRing.frameSize * 2, uniformRing.buffer.createInfo.size);
+      ASSERT_NE(nullptr, uniformRing.data);
+
+      ASSERT_THROW(uniformRing.beginFrame(2), std::runtime_error);
+
+      uint32_t value1 = 1;
+      uint32_t value2 = 2;
+
+      uniformRing.beginFrame(1);
+      uint32_t offset1 = uniformRing.push(value1);
+      uint32_t offset2 = uniformRing.push(value2);
+      ASSERT_EQ(uniformRing.frameSize, offset1);
+      ASSERT_EQ(MemoryBlock::alignUp(offset1 + sizeof(uint32_t), alignment), offset2);
+      ASSERT_EQ(0, offset2 % alignment);
+      ASSERT_EQ(value2, *reinterpret_cast<const uint32_t*>(static_cast<const char*>(uniformRing.data) + offset2));
+
+      std::vector<char> block(uniformRing.frameSize);
+      ASSERT_THROW(uniformRing.push(block.data(), block.size()), std::runtime_error);
+
+      uniformRing.beginFrame(0);
+      ASSERT_EQ(0, uniformRing.push(block.data(), block.size()));
+      ASSERT_THROW(uniformRing.push(value1), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
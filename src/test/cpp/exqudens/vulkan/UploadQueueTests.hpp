@@ -0,0 +1,47 @@
+#pragma once
+
+#include <optional>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "TestUtils.hpp"
+#include "exqudens/vulkan/UploadQueue.hpp"
+
+namespace exqudens::vulkan {
+
+  class UploadQueueTests : public testing::Test {
+  };
+
+  TEST_F(UploadQueueTests, test1) {
+    try {
+      UploadQueue::Ring ring = {};
+      ring.capacity = 256;
+      ring.alignment = 16;
+
+      ASSERT_EQ(0, ring.reserve(1, true));
+      ASSERT_EQ(16, ring.reserve(1, false));
+      ASSERT_EQ(0, ring.reserve(100, true));
+      ASSERT_EQ(112, ring.reserve(50, false));
+      ASSERT_EQ(162, ring.head);
+      ASSERT_EQ(std::nullopt, ring.reserve(100, false));
+      ASSERT_EQ(162, ring.head);
+
+      ring.retire(100);
+      ASSERT_EQ(0, ring.reserve(100, false));
+      ASSERT_EQ(100, ring.head);
+      ASSERT_EQ(std::nullopt, ring.reserve(1, false));
+
+      ring.retire(162);
+      ASSERT_EQ(112, ring.reserve(40, false));
+      ASSERT_EQ(std::nullopt, ring.reserve(20, false));
+
+      ASSERT_EQ(0, ring.reserve(256, true));
+      ASSERT_EQ(256, ring.head);
+      ASSERT_EQ(0, ring.tail);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -664,10 +664,47 @@ function(set_gnu_toolchain_content_delegate var)
     endif()
 endfunction()
 
+function(spirv_to_header input output name namespace)
+    foreach(i input output name)
+        if("" STREQUAL "${${i}}")
+            message(FATAL_ERROR "Empty value not supported for '${i}'.")
+        endif()
+    endforeach()
+    file(READ "${input}" func_hex HEX)
+    string(LENGTH "${func_hex}" func_hex_length)
+    math(EXPR func_remainder "${func_hex_length} % 8")
+    if("0" STREQUAL "${func_hex_length}" OR NOT "0" STREQUAL "${func_remainder}")
+        message(FATAL_ERROR "Invalid SPIR-V size: '${input}'")
+    endif()
+    math(EXPR func_word_count "${func_hex_length} / 8")
+    set(func_indent "")
+    if(NOT "" STREQUAL "${namespace}")
+        set(func_indent "  ")
+    endif()
+    string(REGEX REPLACE "(..)(..)(..)(..)" "0x\\4\\3\\2\\1, " func_words "${func_hex}")
+    set(func_word "0x[0-9a-f]+, ")
+    string(REGEX REPLACE "(${func_word}${func_word}${func_word}${func_word}${func_word}${func_word}${func_word}${func_word})" "\\1\n" func_words "${func_words}")
+    string(REGEX REPLACE ", \n" ",\n" func_words "${func_words}")
+    string(REGEX REPLACE "[, \n]+$" "" func_words "${func_words}")
+    string(REPLACE "\n" "\n${func_indent}    " func_words "${func_words}")
+    set(func_content "#pragma once\n\n#include <cstdint>\n#include <array>\n\n")
+    if(NOT "" STREQUAL "${namespace}")
+        string(APPEND func_content "namespace ${namespace} {\n\n")
+    endif()
+    string(APPEND func_content "${func_indent}inline constexpr std::array<uint32_t, ${func_word_count}> ${name} = {\n")
+    string(APPEND func_content "${func_indent}    ${func_words}\n")
+    string(APPEND func_content "${func_indent}};\n")
+    if(NOT "" STREQUAL "${namespace}")
+        string(APPEND func_content "\n}\n")
+    endif()
+    file(WRITE "${output}" "${func_content}")
+endfunction()
+
 function(script_execute args)
     set(options
         "help"
         "toolchain"
+        "spirv"
     )
     set(oneValueKeywords
         "processor"
@@ -678,6 +715,10 @@ function(script_execute args)
         "target"
         "path"
         "file"
+        "input"
+        "output"
+        "name"
+        "namespace"
     )
     cmake_parse_arguments("func" "${options}" "${oneValueKeywords}" "" "${args}")
 
@@ -728,6 +769,8 @@ function(script_execute args)
             "  file: '${func_file}'"
         )
         message(FATAL_ERROR "${error_message}")
+    elseif("TRUE" STREQUAL "${func_spirv}" OR "ON" STREQUAL "${func_spirv}")
+        spirv_to_header("${func_input}" "${func_output}" "${func_name}" "${func_namespace}")
     elseif("TRUE" STREQUAL "${func_help}" OR "ON" STREQUAL "${func_help}")
         get_filename_component(func_current_file_name "${CMAKE_CURRENT_LIST_FILE}" NAME)
 
@@ -748,12 +791,19 @@ function(script_execute args)
             "path" "'path/to/cl.exe'"
             "file" "'toolchain.cmake|build/toolchain.cmake'"
         )
+        string(JOIN " " func_usage_4 "cmake" "-P" "${func_current_file_name}" "spirv"
+            "input" "'path/to/shader.vert.spv'"
+            "output" "'path/to/shader.vert.hpp'"
+            "name" "'SHADER_VERT'"
+            "namespace" "'<value>'"
+        )
 
         string(JOIN "\n" func_content
             "Usage:"
             "  ${func_usage_1}"
             "  ${func_usage_2}"
             "  ${func_usage_3}"
+            "  ${func_usage_4}"
         )
         message("${func_content}")
     endif()